@@ -0,0 +1,75 @@
+#ifndef CETHASH_H
+#define CETHASH_H
+#include <stdint.h>
+
+// libcethash: Ethash for embedding in another process (make lib)
+// a light context holds the cache of one epoch, a full context its dataset;
+// both are read only once made, so any number of threads may hash with the
+// same context at once. every function writes to buffers of the caller
+// only and the library keeps no state of its own besides its contexts
+
+#if defined(LIBCETHASH) && defined(__GNUC__)
+#define CETHASH_API __attribute__((visibility("default")))
+#else
+#define CETHASH_API
+#endif
+
+// longest header the hashing functions accept, in bytes; the hashes of
+// the chain are 32 byte header hashes, the limit bounds stack use
+#define CETHASH_MAX_HEADER 1024
+
+struct CethashLight;
+struct CethashFull;
+
+// output of one hash
+struct CethashResult {
+    unsigned char mix_digest[32];  // sealed into the block with the nonce
+    unsigned char result[32];      // compared against the difficulty boundary
+};
+
+// make the cache of the epoch of block_number (around 16MB, around a second)
+// output: NULL if it cannot be allocated; release with cethash_light_free()
+CETHASH_API struct CethashLight* cethash_light_new(uint64_t block_number);
+CETHASH_API void cethash_light_free(struct CethashLight* light);
+
+// same as cethash_light_new(), but maps the cache saved in directory dir
+// when its seedhash, size and checksum match, and saves a newly made one
+// there (dir is created if missing); processes may share dir
+CETHASH_API struct CethashLight* cethash_light_load(uint64_t block_number, const char* dir);
+
+// make the dataset of the epoch of light (around 1GB, minutes)
+// light is only read and may be freed afterwards
+// input: threads: number of generator threads, <= 0 means one per online core
+// output: NULL if it cannot be allocated; release with cethash_full_free()
+CETHASH_API struct CethashFull* cethash_full_new(const struct CethashLight* light, int threads);
+CETHASH_API void cethash_full_free(struct CethashFull* full);
+
+// epoch and sizes in bytes a context was made for
+CETHASH_API uint64_t cethash_light_epoch(const struct CethashLight* light);
+CETHASH_API uint64_t cethash_light_cache_size(const struct CethashLight* light);
+CETHASH_API uint64_t cethash_full_dag_size(const struct CethashFull* full);
+
+// hash header + nonce; the light version computes the 128 dataset items it
+// needs from the cache, both give the same result
+// every function below takes 0 <= header_size <= CETHASH_MAX_HEADER
+// output: 1, or 0 without touching out if header_size is out of range
+CETHASH_API int cethash_light_compute(const struct CethashLight* light, const char* header, int header_size,
+                                      uint64_t nonce, struct CethashResult* out);
+CETHASH_API int cethash_full_compute(const struct CethashFull* full, const char* header, int header_size,
+                                     uint64_t nonce, struct CethashResult* out);
+
+// check a sealed header from the cache only: mix_digest (32 bytes) must be
+// the one of header + nonce and the result must meet difficulty
+// output: 1 if valid, 0 otherwise (also if header_size is out of range)
+CETHASH_API int cethash_verify(const struct CethashLight* light, const char* header, int header_size,
+                               uint64_t nonce, const unsigned char* mix_digest, uint64_t difficulty);
+
+// try nonces start .. start + count - 1 in order on the calling thread,
+// threads searching the same full context should take disjoint ranges
+// output: 1 and the first nonce meeting difficulty in nonce and out, 0 if none
+//         does or header_size is out of range
+CETHASH_API int cethash_search(const struct CethashFull* full, const char* header, int header_size,
+                               uint64_t start, uint64_t count, uint64_t difficulty,
+                               uint64_t* nonce, struct CethashResult* out);
+
+#endif
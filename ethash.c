@@ -4,13 +4,47 @@
 #include <math.h>  // pow
 #include <string.h>
 #include <inttypes.h> // uint64
+#include <pthread.h>
+#include <unistd.h>   // sysconf
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>     // clock_gettime
+#include <sys/resource.h> // setpriority
+#include <sys/syscall.h>  // SYS_gettid
+#include <getopt.h>
 #include "lib/sha3.h" // Credit: https://github.com/brainhub/SHA3IUF/blob/master/sha3.h
 #include "lib/mt64.h" // http://www.math.sci.hiroshima-u.ac.jp/~m-mat/MT/emt64.html
+#include "sizes.h"
+#include "cethash.h"
 
-// change this for testing
-#define CACHE_SIZE 1024     // cache size (should be around 16MB)
-#define DATASET_SIZE 300*1024*1024  // dataset size (shoule be around 1GB)
+// defaults of the command line options, see usage()
+#define BLOCK_NUMBER 1      // block to work on, sizes and seedhash follow from its epoch
 #define TIME_LIMIT  100     // maximum times of mining, will give up if reach this limit
+#define GEN_THREADS 0       // threads used to make dataset, 0 means one per online core
+#define MINE_THREADS 0      // threads used to mine, 0 means one per online core
+#define DAG_PATH "dataset"  // dataset file written by gen and mapped by the mmap backend
+#define CACHE_DIR "caches"  // light caches are saved here and mapped back by later runs
+#define DIFFICULTY 0x4000   // difficulty of the block to mine, the one of the genesis block of
+                            // https://lightrains.com/blogs/setup-local-ethereum-blockchain-private-testnet
+#define SHARE_DIFFICULTY 0  // if != 0, pool share difficulty, hashes meeting it are counted while mining
+#define METRICS_INTERVAL 5  // seconds between two exports once --metrics is given, 0 disables them
+#define HUGE_PAGES  1       // if != 0, back cache and dataset with huge pages where available
+#define NUMA_MODE "none"    // dataset placement on multi-socket hosts: none, interleave or replicate
+
+// change this for testing
+#define GEN_CHUNK   1024    // dataset items a generator thread claims at a time
+#define HASH_BATCH  16      // items or nonces fed to one multi-buffer Keccak call,
+                            // also the nonces a mining thread keeps in flight
+#define CACHE_SLOTS 3       // light caches (epochs) kept resident by a CacheManager
+#define PREGEN_THREADS 1    // threads building the next epoch's dataset in the background, 0 is one per core
+#define PREGEN_NICE 19      // nice value of those threads, so mining keeps the cores
+#define CHECKPOINT_ITEMS (1 << 20)  // items save_dataset makes and makes durable at a time (64MB)
+#define SPOT_CHECKS 16      // written items recomputed before a resumed save_dataset goes on
+#define METRICS_WINDOW 60   // seconds covered by the sliding hashrate and generation rate
+#define BENCH_SECONDS 0.5   // minimum length of one measured benchmark run
+#define BENCH_RUNS  5       // measured runs per benchmark, the median is reported
+#define VERIFY_SHARES 1000  // shares made and checked by the verify command
 // #define PRINT_RESULT        // if define, will print result of each try on mining
 
 
@@ -29,6 +63,62 @@
 #define ACCESSES 64  // number of accesses in hashimoto loop
 #define FNV_PRIME 0x01000193  // fnv() parameter
 
+// derived layout parameters
+#define NODE_WORDS (HASH_BYTES / WORD_BYTES)  // words in one 64 byte cache/dataset node
+#define MIX_WORDS (MIX_BYTES / WORD_BYTES)  // words in the mix
+#define DIGEST_WORDS (NODE_WORDS + MIX_WORDS / 4)  // s followed by cmix, input of the final sha3_256
+
+
+// where hashimoto gets its dataset pages from
+enum Backend {
+    BACKEND_DEFAULT,  // the one of the command
+    BACKEND_MEMORY,   // dataset generated in memory
+    BACKEND_MMAP,     // dataset file written by gen, mapped
+    BACKEND_LIGHT     // pages computed from the cache on demand
+};
+
+const char* backend_names[] = { "default", "memory", "mmap", "light" };
+
+// run time settings, from the command line
+struct Options {
+    uint64_t block;
+    uint64_t cache_size;        // if != 0, overrides the cache size of the epoch (around 16MB)
+    uint64_t dag_size;          // if != 0, overrides the dataset size of the epoch (around 1GB)
+    uint64_t nonces;            // nonce budget of one mining run
+    int gen_threads;
+    int mine_threads;
+    int pregen_threads;         // threads building the next epoch's dataset in the background
+    const char* dag_path;
+    const char* cache_dir;      // NULL to neither load nor save caches
+    enum Backend backend;
+    int huge_pages;
+    int mlock;                  // pin a mapped dataset file in memory before mining
+    const char* numa;
+    uint64_t difficulty;
+    uint64_t share_difficulty;
+    const char* metrics_path;   // metrics are exported to <path>.prom and <path>.json, NULL for none
+    int metrics_interval;
+};
+
+// the library (-DLIBCETHASH) has no command line, it only reads the defaults
+#ifdef LIBCETHASH
+static const
+#endif
+struct Options options = {
+    .block = BLOCK_NUMBER,
+    .nonces = TIME_LIMIT,
+    .gen_threads = GEN_THREADS,
+    .mine_threads = MINE_THREADS,
+    .pregen_threads = PREGEN_THREADS,
+    .dag_path = DAG_PATH,
+    .cache_dir = CACHE_DIR,
+    .huge_pages = HUGE_PAGES,
+    .numa = NUMA_MODE,
+    .difficulty = DIFFICULTY,
+    .share_difficulty = SHARE_DIFFICULTY,
+    .metrics_interval = METRICS_INTERVAL,
+};
+
 
 // Credit: https://stackoverflow.com/questions/8534274/is-the-_strrev-function-not-available-in-linux
 //char *_strrev(char *str)
@@ -50,556 +140,2598 @@
 //    return str;
 //}
 
-// convert a byte array to int
-// input: byte array
-// output: corresponding int
-int decode_int(char* s) {
-    if (!s) {
-        return 0;
-    }
 
-    char hex[9];
+// Words are kept in host order and hashed as their in-memory bytes,
+// which is the little endian serialization of the spec on the x86/ARM
+// hosts this program targets. All hashing goes through the fixed-size
+// keccak_256/keccak_512 of lib/sha3.h straight into caller buffers.
+
+// sha3_512 of one 64 byte node into out (16 words), out may alias in
+void sha3_512_node(unsigned int* out, const unsigned int* in) {
+    keccak_512_64(out, in);
+}
+
 
-    // convert byte array to hex string
-    // here consider little endian
-    snprintf(hex, 9, "%02x%02x%02x%02x", (unsigned char)s[3],
-        (unsigned char)s[2], (unsigned char)s[1], (unsigned char)s[0]);
-    int number = (int)strtol(hex, NULL, 16);
+struct Block {
+    uint64_t number;
+};
 
-    return number;
+// (v1 * FNV_PRIME ^ v2) % 2 ** 32, done by unsigned overflow
+unsigned int fnv(unsigned int v1, unsigned int v2) {
+    return v1 * FNV_PRIME ^ v2;
 }
 
+// the hot dataset and mix kernels, built once per instruction set
+// (see KERNEL_VARIANT) and picked at startup by select_kernels()
+struct Kernels {
+    const char* name;
+    int (*supported)();
+    void (*dataset_items)(unsigned int* out, const unsigned int* cache, int len, int start, int count);
+    void (*mix)(unsigned int* s_cmix, uint64_t full_size, const unsigned int* dataset);
+    void (*mix_batch)(unsigned int (*s_cmix)[DIGEST_WORDS], int count, uint64_t full_size,
+                      const unsigned int* dataset);
+};
 
-// encode int to byte array
-// input: s : int to covert
-//        pad_length : = length to pad by '\0' (should not < 4)
-// output: byte array
-// note: will malloc string
-char* encode_int(int s, int pad_length) {
-    if (s == 0) {
-        return "";
-    }
+// set once before main(), read only afterwards
+static const struct Kernels* kernels;
+
+
+// monotonic wall clock in seconds, for rates and timings
+double now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
 
-    char hex[8];
 
-    // convert s to hex string
-    int hex_len = snprintf(hex, 9, "%x", s);
+// Metrics
+// counters are spread over METRICS_SLOTS cache line sized slots, a thread
+// always adds to the same slot with a relaxed atomic add and readers sum
+// all slots, so the hot paths never take a lock nor share a line with
+// another thread (as long as there are no more threads than slots)
+// hot paths count once per batch or chunk, not once per word
+#define METRICS_SLOTS 64
+
+enum Counter {
+    COUNT_HASHES,           // hashimoto evaluations, full and light
+    COUNT_DAG_READS,        // 128 byte dataset pages read by hashimoto_full
+    COUNT_ITEMS,            // dataset items generated
+    COUNT_FILE_READS,       // reads from dataset and journal files
+    COUNT_FILE_READ_BYTES,
+    COUNT_ALLOCS,           // cache and dataset buffers allocated
+    COUNT_ALLOC_BYTES,
+    COUNTERS
+};
 
+enum Phase {
+    PHASE_MKCACHE,
+    PHASE_CALC_DATASET,
+    PHASE_MINING,
+    PHASES
+};
 
-    // pad 0 at begin to make len be even
-    char padded_hex[8];
+#ifdef LIBCETHASH
+// the library keeps no process wide state, nothing is counted
+static inline void count_add(enum Counter c, uint64_t n) {}
+static inline void phase_done(enum Phase p, double begin) {}
+static inline void generation_started(uint64_t total, uint64_t done) {}
+#else
+const char* counter_names[] = {
+    "hashes", "dag_page_reads", "items_generated", "file_reads", "file_read_bytes",
+    "allocations", "allocated_bytes"
+};
 
-    // fix bug here: use strcat or strcpy leads to core dump in gem5
-    if (hex_len % 2 == 1) {
-        padded_hex[0] = '0';
-        for (int i = 0; i < hex_len; i++) {
-            padded_hex[i + 1] = hex[i];
-        }
-        hex_len += 1;
-    }
-    else {
-        for (int i = 0; i < hex_len; i++) {
-            padded_hex[i] = hex[i];
-        }
-    }
+const char* phase_names[] = { "mkcache", "calc_dataset", "mining" };
 
-    // convert hex string to bytearray, little endian
-    char* bytearray = malloc(pad_length);
-    char* pos = padded_hex;
+struct CounterSlot {
+    uint64_t v[COUNTERS];
+} __attribute__((aligned(64)));
 
-    int num_pad = pad_length - (hex_len / 2);
+// one sample of the sliding window
+struct MetricsSample {
+    double time;
+    uint64_t hashes;
+    uint64_t items;
+};
+
+// enough for a window of samples one second apart, the shortest interval
+#define METRICS_SAMPLES (METRICS_WINDOW + 1)
+
+struct Metrics {
+    struct CounterSlot slots[METRICS_SLOTS];
+    int next_slot;
+    uint64_t phase_ns[PHASES];   // time spent in each phase, summed over runs
+    uint64_t phase_runs[PHASES];
+    uint64_t gen_total;          // items of the dataset being generated
+    uint64_t gen_done;           // items already there when it started (resume)
+    uint64_t gen_items;          // COUNT_ITEMS when it started
+
+    // exporter, only touched by metrics_start(), metrics_stop() and its thread
+    pthread_t exporter;
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    int running;
+    struct MetricsSample samples[METRICS_SAMPLES];
+    int sampled;
+};
+
+struct Metrics metrics = { .lock = PTHREAD_MUTEX_INITIALIZER, .wake = PTHREAD_COND_INITIALIZER };
+__thread struct CounterSlot* metrics_slot;
 
-    for (int count = 1; count <= (hex_len / 2); count++) {
-        sscanf((unsigned char*)pos, "%2hhx", &bytearray[pad_length - num_pad - count]);
-        pos += 2;
+// add n to counter c of the calling thread
+static inline void count_add(enum Counter c, uint64_t n) {
+    if (!metrics_slot) {
+        int i = __atomic_fetch_add(&metrics.next_slot, 1, __ATOMIC_RELAXED);
+        metrics_slot = &metrics.slots[i % METRICS_SLOTS];
     }
+    __atomic_fetch_add(&metrics_slot->v[c], n, __ATOMIC_RELAXED);
+}
 
-    // pad '0/'
-    for (int count = (hex_len / 2) + 1; count <= pad_length; count++) {
-        bytearray[count] = '\0';
+// total of counter c over all threads
+uint64_t counter_total(enum Counter c) {
+    uint64_t total = 0;
+    for (int i = 0; i < METRICS_SLOTS; i++) {
+        total += __atomic_load_n(&metrics.slots[i].v[c], __ATOMIC_RELAXED);
     }
+    return total;
+}
 
-    return bytearray;
+// add the time since begin (from now_seconds()) to phase p
+void phase_done(enum Phase p, double begin) {
+    __atomic_fetch_add(&metrics.phase_ns[p], (uint64_t)((now_seconds() - begin) * 1e9), __ATOMIC_RELAXED);
+    __atomic_fetch_add(&metrics.phase_runs[p], 1, __ATOMIC_RELAXED);
 }
 
+// a dataset of total items starts being generated, done of them are already there
+void generation_started(uint64_t total, uint64_t done) {
+    __atomic_store_n(&metrics.gen_items, counter_total(COUNT_ITEMS), __ATOMIC_RELAXED);
+    __atomic_store_n(&metrics.gen_done, done, __ATOMIC_RELAXED);
+    __atomic_store_n(&metrics.gen_total, total, __ATOMIC_RELAXED);
+}
 
-// encode uint64 to byte array (padded to 8 bytes)
-// input: s : uint64 to covert
-// output: 8 bytes char array
-// note: will malloc string
-char* encode_int64(uint64_t s) {
-    if (s == 0) {
-        return "";
+// rates over the sliding window, from the oldest sample kept to now
+void metrics_rates(const struct MetricsSample* now, double* hashrate, double* item_rate) {
+    *hashrate = 0;
+    *item_rate = 0;
+    if (metrics.sampled == 0) {
+        return;
     }
+    int window = METRICS_WINDOW / options.metrics_interval + 1;
+    int kept = metrics.sampled < window ? metrics.sampled : window;
+    const struct MetricsSample* old = &metrics.samples[(metrics.sampled - kept) % METRICS_SAMPLES];
+    double span = now->time - old->time;
+    if (span > 0) {
+        *hashrate = (now->hashes - old->hashes) / span;
+        *item_rate = (now->items - old->items) / span;
+    }
+}
 
-    char hex[16];
-
-    // convert s to hex string
-    int hex_len = snprintf(hex, 17, "%lx", s);
-
+// write a file through a temporary one and rename it, so readers never see
+// a half written export
+FILE* open_export(const char* path, char* tmp, size_t tmp_size) {
+    snprintf(tmp, tmp_size, "%s.tmp", path);
+    return fopen(tmp, "w");
+}
 
-    // pad 0 at begin to make len be even
-    char padded_hex[16];
+void close_export(FILE* f, const char* path, const char* tmp) {
+    if (fclose(f) != 0 || rename(tmp, path) != 0) {
+        unlink(tmp);
+    }
+}
 
-    // fix bug here: use strcat or strcpy leads to core dump in gem5
-    if (hex_len % 2 == 1) {
-        padded_hex[0] = '0';
-        for (int i = 0; i < hex_len; i++) {
-            padded_hex[i + 1] = hex[i];
+// take a sample and write <metrics path>.prom (Prometheus text format) and
+// <metrics path>.json
+void metrics_export() {
+    uint64_t totals[COUNTERS];
+    for (int c = 0; c < COUNTERS; c++) {
+        totals[c] = counter_total(c);
+    }
+    struct MetricsSample now = { now_seconds(), totals[COUNT_HASHES], totals[COUNT_ITEMS] };
+    double hashrate, item_rate;
+    metrics_rates(&now, &hashrate, &item_rate);
+    metrics.samples[metrics.sampled % METRICS_SAMPLES] = now;
+    metrics.sampled++;
+
+    uint64_t gen_total = __atomic_load_n(&metrics.gen_total, __ATOMIC_RELAXED);
+    uint64_t gen_done = __atomic_load_n(&metrics.gen_done, __ATOMIC_RELAXED) + totals[COUNT_ITEMS] -
+                        __atomic_load_n(&metrics.gen_items, __ATOMIC_RELAXED);
+    if (gen_done > gen_total) {
+        gen_done = gen_total;
+    }
+    // -1 while there is no rate to go by
+    double eta = gen_done == gen_total ? 0 : item_rate > 0 ? (gen_total - gen_done) / item_rate : -1;
+
+    char path[strlen(options.metrics_path) + 6];
+    char tmp[sizeof(path) + 4];
+
+    snprintf(path, sizeof(path), "%s.prom", options.metrics_path);
+    FILE* f = open_export(path, tmp, sizeof(tmp));
+    if (f) {
+        for (int c = 0; c < COUNTERS; c++) {
+            fprintf(f, "# TYPE cethash_%s_total counter\ncethash_%s_total %" PRIu64 "\n",
+                    counter_names[c], counter_names[c], totals[c]);
+        }
+        fprintf(f, "# TYPE cethash_phase_seconds_total counter\n");
+        for (int p = 0; p < PHASES; p++) {
+            fprintf(f, "cethash_phase_seconds_total{phase=\"%s\"} %.3f\n", phase_names[p],
+                    __atomic_load_n(&metrics.phase_ns[p], __ATOMIC_RELAXED) * 1e-9);
         }
-        hex_len += 1;
+        fprintf(f, "# TYPE cethash_phase_runs_total counter\n");
+        for (int p = 0; p < PHASES; p++) {
+            fprintf(f, "cethash_phase_runs_total{phase=\"%s\"} %" PRIu64 "\n", phase_names[p],
+                    __atomic_load_n(&metrics.phase_runs[p], __ATOMIC_RELAXED));
+        }
+        fprintf(f, "# TYPE cethash_hashrate gauge\ncethash_hashrate %.1f\n", hashrate);
+        fprintf(f, "# TYPE cethash_generation_items gauge\ncethash_generation_items %" PRIu64 "\n", gen_done);
+        fprintf(f, "# TYPE cethash_generation_items_total gauge\ncethash_generation_items_total %" PRIu64 "\n",
+                gen_total);
+        fprintf(f, "# TYPE cethash_generation_eta_seconds gauge\ncethash_generation_eta_seconds %.1f\n", eta);
+        close_export(f, path, tmp);
     }
-    else {
-        for (int i = 0; i < hex_len; i++) {
-            padded_hex[i] = hex[i];
+
+    snprintf(path, sizeof(path), "%s.json", options.metrics_path);
+    f = open_export(path, tmp, sizeof(tmp));
+    if (f) {
+        fprintf(f, "{\n  \"counters\": {");
+        for (int c = 0; c < COUNTERS; c++) {
+            fprintf(f, "%s\"%s\": %" PRIu64, c ? ", " : "", counter_names[c], totals[c]);
         }
+        fprintf(f, "},\n  \"phases\": {");
+        for (int p = 0; p < PHASES; p++) {
+            fprintf(f, "%s\"%s\": {\"seconds\": %.3f, \"runs\": %" PRIu64 "}", p ? ", " : "", phase_names[p],
+                    __atomic_load_n(&metrics.phase_ns[p], __ATOMIC_RELAXED) * 1e-9,
+                    __atomic_load_n(&metrics.phase_runs[p], __ATOMIC_RELAXED));
+        }
+        fprintf(f, "},\n  \"hashrate\": %.1f,\n  \"window_seconds\": %d,\n", hashrate, METRICS_WINDOW);
+        fprintf(f, "  \"generation\": {\"items\": %" PRIu64 ", \"total\": %" PRIu64 ", \"eta_seconds\": %.1f}\n}\n",
+                gen_done, gen_total, eta);
+        close_export(f, path, tmp);
     }
+}
 
-    // convert hex string to bytearray, little endian
-    char* bytearray = malloc(8);
-    char* pos = padded_hex;
+// exporter thread: export every metrics interval until stopped
+void* metrics_exporter(void* arg) {
+    pthread_mutex_lock(&metrics.lock);
+    while (metrics.running) {
+        struct timespec until;
+        clock_gettime(CLOCK_REALTIME, &until);
+        until.tv_sec += options.metrics_interval;
+        pthread_cond_timedwait(&metrics.wake, &metrics.lock, &until);
+        if (metrics.running) {
+            metrics_export();
+        }
+    }
+    pthread_mutex_unlock(&metrics.lock);
+    return NULL;
+}
 
-    int num_pad = 8 - (hex_len / 2);
+// start the periodic export, if the metrics interval is not 0
+void metrics_start() {
+    if (!options.metrics_path || options.metrics_interval <= 0) {
+        return;
+    }
+    metrics_export();
+    metrics.running = 1;
+    if (pthread_create(&metrics.exporter, NULL, metrics_exporter, NULL) != 0) {
+        metrics.running = 0;
+    }
+}
 
-    for (int count = 1; count <= (hex_len / 2); count++) {
-        sscanf((unsigned char*)pos, "%2hhx", &bytearray[8 - num_pad - count]);
-        pos += 2;
+// stop the export thread and write a last export with the final values
+void metrics_stop() {
+    if (!metrics.running) {
+        return;
     }
+    pthread_mutex_lock(&metrics.lock);
+    metrics.running = 0;
+    pthread_cond_signal(&metrics.wake);
+    pthread_mutex_unlock(&metrics.lock);
+    pthread_join(metrics.exporter, NULL);
+    metrics_export();
+}
+#endif // LIBCETHASH
+
 
-    // pad '0/'
-    for (int count = (hex_len / 2) + 1; count <= 8; count++) {
-        bytearray[count] = '\0';
+#ifndef MAP_HUGE_SHIFT
+#define MAP_HUGE_SHIFT 26
+#endif
+#define MAP_HUGE_2MB_PAGES (21 << MAP_HUGE_SHIFT)
+#define MAP_HUGE_1GB_PAGES (30 << MAP_HUGE_SHIFT)
+
+#define HUGE_PAGE_WASTE 8  // a huge page size is skipped if rounding up wastes more than 1/8
+
+// how the pages of a node buffer are backed, in order of preference
+enum PageMode {
+    PAGES_HUGETLB_1GB,  // explicit 1GB huge pages
+    PAGES_HUGETLB_2MB,  // explicit 2MB huge pages
+    PAGES_THP,          // normal mapping advised for transparent huge pages
+    PAGES_NORMAL,       // normal pages
+    PAGES_FILE          // private mapping of a cache file, see map_cache_file()
+};
+
+const char* page_mode_names[] = {
+    "1GB huge pages", "2MB huge pages", "transparent huge pages (advised)", "normal pages",
+    "mapped cache file"
+};
+
+// kept in the slack right behind the nodes, so free_nodes() knows
+// what to unmap without any bookkeeping elsewhere
+struct NodesTrailer {
+    size_t map_len;
+    enum PageMode mode;
+};
+
+// mmap len bytes (a multiple of the page size of mode) backed as mode
+void* map_nodes(size_t len, enum PageMode mode) {
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+    if (mode == PAGES_HUGETLB_1GB) {
+        flags |= MAP_HUGETLB | MAP_HUGE_1GB_PAGES;
+    }
+    else if (mode == PAGES_HUGETLB_2MB) {
+        flags |= MAP_HUGETLB | MAP_HUGE_2MB_PAGES;
     }
 
-    return bytearray;
+    void* p = mmap(NULL, len, PROT_READ | PROT_WRITE, flags, -1, 0);
+    if (p == MAP_FAILED) {
+        return NULL;
+    }
+    if (mode == PAGES_THP) {
+        madvise(p, len, MADV_HUGEPAGE);
+    }
+    return p;
 }
 
+// allocate a flat word buffer for n 64 byte nodes
+// page aligned (so aligned to MIX_BYTES), node k lives at buf + k * NODE_WORDS
+// and each 128 byte mix page covers exactly two adjacent cache lines
+// with options.huge_pages, explicit 1GB or 2MB huge pages are tried first, since
+// hashimoto's random reads miss the TLB on almost every access with 4KB
+// pages, then transparent huge pages
+// output: word array, NULL if it cannot be allocated; release with free_nodes()
+unsigned int* try_alloc_nodes(size_t n) {
+    // room for the trailer right behind the nodes
+    size_t bytes = n * HASH_BYTES + sizeof(struct NodesTrailer);
+    size_t page = sysconf(_SC_PAGESIZE);
+    size_t page_sizes[] = { (size_t)1 << 30, (size_t)1 << 21, (size_t)1 << 21, page };
+
+    void* p = NULL;
+    enum PageMode mode = options.huge_pages ? PAGES_HUGETLB_1GB : PAGES_NORMAL;
+    size_t len = 0;
+    for (; mode <= PAGES_NORMAL; mode++) {
+        len = (bytes + page_sizes[mode] - 1) / page_sizes[mode] * page_sizes[mode];
+        // do not round a buffer up by more than 1/HUGE_PAGE_WASTE of the mapping,
+        // e.g. a 1.01GB dataset to two 1GB pages; smaller pages come next
+        if (mode != PAGES_NORMAL && (len - bytes) * HUGE_PAGE_WASTE > len) {
+            continue;
+        }
+        if ((p = map_nodes(len, mode)) != NULL) {
+            break;
+        }
+    }
 
-// convert given int array to a long hex encoded byte array
-// input: int array and its length
-// output: byte array
-char* serialize_hash(int* h, int length) {
-    char* hash = (char*)malloc(4 * length);
+    if (!p) {
+        return NULL;
+    }
 
-    for (int i = 0; i < length; i++) {
-        char* temp = encode_int(h[i], 4);
+    struct NodesTrailer* t = (struct NodesTrailer*)((char*)p + n * HASH_BYTES);
+    t->map_len = len;
+    t->mode = mode;
+    count_add(COUNT_ALLOCS, 1);
+    count_add(COUNT_ALLOC_BYTES, n * HASH_BYTES);
+    return p;
+}
 
-        strcat(hash, temp);
+// same as try_alloc_nodes(), but gives up on the whole program on failure
+unsigned int* alloc_nodes(size_t n) {
+    unsigned int* p = try_alloc_nodes(n);
+    if (!p) {
+        printf("Cannot allocate %zu bytes.\n", n * HASH_BYTES);
+        exit(0);
     }
+    return p;
+}
 
-    return hash;
+// name of the page backing actually in effect for a buffer of n nodes
+const char* nodes_page_mode(const unsigned int* buf, size_t n) {
+    const struct NodesTrailer* t = (const struct NodesTrailer*)(buf + n * NODE_WORDS);
+    return page_mode_names[t->mode];
 }
 
+// release a buffer of n nodes from alloc_nodes(), NULL is ignored
+void free_nodes(unsigned int* buf, size_t n) {
+    if (!buf) {
+        return;
+    }
+    const struct NodesTrailer* t = (const struct NodesTrailer*)(buf + n * NODE_WORDS);
+    munmap(buf, t->map_len);
+}
 
-// convert a long hex encoded byte array to int array
-// input: byte array and its length
-// output int array
-// note: will malloc int array
-int* deserialize_hash(char* h, int length) {
-    // each int correspoding to 4 bytes in bytes array
-    int* hash = (int*)malloc(length * sizeof(int));
 
-    // convert each 4 bytes to int
-    char* pos = h;
+// NUMA placement of the dataset
+// hashimoto reads 64 random pages per hash, on a multi-socket host half of
+// them cross the interconnect when the dataset sits on one node
+// mbind and sched_setaffinity are called as raw syscalls and the topology is
+// read from sysfs, so no libnuma is needed; a host without
+// /sys/devices/system/node counts as one node
+#define NUMA_MAX_NODES 64
+#define NUMA_MASK_LONGS 16  // 1024 cpus
+#define MPOL_BIND_MODE 2        // MPOL_BIND in <linux/mempolicy.h>
+#define MPOL_INTERLEAVE_MODE 3  // MPOL_INTERLEAVE
+#define MPOL_MF_MOVE_PAGES (1 << 1)  // MPOL_MF_MOVE, migrate pages already touched
+
+enum NumaMode {
+    NUMA_NONE,        // leave placement to the kernel (first touch)
+    NUMA_INTERLEAVE,  // spread the dataset pages evenly over all nodes
+    NUMA_REPLICATE    // one copy of the dataset per node, threads read the local one
+};
 
-    for (int i = 0; i < strlen(h) / 4; i++) {
-        char temp[4];
-        strncpy(temp, pos, 4);
+const char* numa_mode_names[] = { "none", "interleave", "replicate" };
 
-        hash[i] = decode_int(temp);
+// parse a sysfs list such as "0-3,8-11" into a bit mask
+// output: highest bit set + 1, 0 if the file cannot be read
+int read_sysfs_list(const char* path, unsigned long* mask, int longs) {
+    memset(mask, 0, longs * sizeof(unsigned long));
+    FILE* f = fopen(path, "r");
+    if (!f) {
+        return 0;
     }
 
-    return hash;
+    int top = 0;
+    int lo, hi;
+    while (fscanf(f, "%d", &lo) == 1) {
+        hi = lo;
+        int c = fgetc(f);
+        if (c == '-') {
+            if (fscanf(f, "%d", &hi) != 1) {
+                break;
+            }
+            c = fgetc(f);
+        }
+        for (int b = lo; b <= hi && b < longs * 64; b++) {
+            mask[b / 64] |= 1UL << (b % 64);
+            top = b + 1;
+        }
+        if (c != ',') {
+            break;
+        }
+    }
+    fclose(f);
+    return top;
 }
 
-
-// hash the int array by function h
-// size is the size of x
-// h is a function pointer to hash function
-// will return int array
-// l is a pointer for returned array, compute by this function
-// TODO: check malloc and free
-int* hash_words(char* h(char*, int), int size, char* x) {
-    char* y = h(x, size);
-    return deserialize_hash(y, 16);
+// ids of the NUMA nodes with cpus, which need not be contiguous (e.g. "0,2"
+// after a node went offline); memory only nodes (CXL, HBM) are left out, no
+// thread could run next to a replica there
+// output: number of ids written to ids, at least 1; node 0 if sysfs has no list
+int numa_nodes(int* ids) {
+    unsigned long mask[NUMA_MASK_LONGS];
+    int top = read_sysfs_list("/sys/devices/system/node/has_cpu", mask, NUMA_MASK_LONGS);
+    int nodes = 0;
+    for (int b = 0; b < top && b < NUMA_MAX_NODES; b++) {
+        if (mask[b / 64] & (1UL << (b % 64))) {
+            ids[nodes++] = b;
+        }
+    }
+    if (nodes < 1) {
+        ids[0] = 0;
+        return 1;
+    }
+    return nodes;
 }
 
-
-// same as hash_words(), but x is a int array
-int* hash_words_list(char* h(char*, int), int size, int* x) {
-    char* temp = serialize_hash(x, size);
-    char* y = h(temp, size);
-    return deserialize_hash(y, 16);
+// run the calling thread on the cpus of node only
+// input: saved: if not NULL, receives the previous cpu mask for numa_unbind_thread()
+// output: 1 if bound, 0 if node has no cpus or the kernel refused; saved is
+//         only filled, and numa_unbind_thread() only needed, on 1
+int numa_bind_thread(int node, unsigned long* saved) {
+    char path[64];
+    unsigned long mask[NUMA_MASK_LONGS];
+    snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", node);
+    if (read_sysfs_list(path, mask, NUMA_MASK_LONGS) == 0) {
+        return 0;
+    }
+    if (saved && syscall(SYS_sched_getaffinity, 0, NUMA_MASK_LONGS * sizeof(unsigned long), saved) < 0) {
+        return 0;
+    }
+    return syscall(SYS_sched_setaffinity, 0, sizeof(mask), mask) == 0;
 }
 
+void numa_unbind_thread(const unsigned long* saved) {
+    syscall(SYS_sched_setaffinity, 0, NUMA_MASK_LONGS * sizeof(unsigned long), saved);
+}
 
-// A warpper for sha3_HashBuffer() in lib/sha3.h
-// will be used by sha3 as a function pointer
-char* sha3_512_wrapper(char* x, int size) {
-    char* out = malloc(512);
-    sha3_HashBuffer(512, SHA3_FLAGS_KECCAK, x, size, out, 512);
-    return out;
+// apply memory policy mode over the nodes in nodemask to len bytes at p,
+// moving pages that are already in memory
+// output: 1 on success, 0 if the kernel refused (e.g. no NUMA support)
+int numa_bind_memory(const void* p, size_t len, int mode, const unsigned long* nodemask) {
+    size_t page = sysconf(_SC_PAGESIZE);
+    uintptr_t start = (uintptr_t)p / page * page;
+    len += (uintptr_t)p - start;
+    return syscall(SYS_mbind, start, len, mode, nodemask,
+                   (unsigned long)NUMA_MAX_NODES + 1, MPOL_MF_MOVE_PAGES) == 0;
 }
 
+// mode from its name, as given by --numa
+// output: the mode, NUMA_NONE for NULL or an unknown name
+enum NumaMode numa_mode_from_name(const char* name) {
+    for (int m = NUMA_NONE; m <= NUMA_REPLICATE && name; m++) {
+        if (strcmp(name, numa_mode_names[m]) == 0) {
+            return m;
+        }
+    }
+    if (name) {
+        printf("Unknown NUMA mode %s, using none.\n", name);
+    }
+    return NUMA_NONE;
+}
 
-// A warpper for sha3_HashBuffer() in lib/sha3.h
-// will be used by sha3 as a function pointer
-char* sha3_256_wrapper(char* x, int size) {
-    char* out = malloc(256);
-    sha3_HashBuffer(256, SHA3_FLAGS_KECCAK, x, size, out, 256);
-    return out;
+// mode chosen on the command line
+enum NumaMode numa_mode_setting() {
+    return numa_mode_from_name(options.numa);
 }
 
+// a dataset as seen by the mining threads of each node
+struct NumaDataset {
+    enum NumaMode mode;
+    int nodes;          // nodes threads are spread over, 1 with NUMA_NONE
+    int ids[NUMA_MAX_NODES];  // node id of each of them, online nodes only
+    const unsigned int* source;
+    const unsigned int* replicas[NUMA_MAX_NODES];  // dataset read by threads bound to node ids[k]
+};
+
+// place a dataset of full_size bytes (in memory or mapped from a file) for mode
+// NUMA_INTERLEAVE migrates its pages in place, NUMA_REPLICATE moves them to
+// the first node and makes one copy for every other node, each allocated and
+// first touched on that node, so there are as many datasets as nodes
+// on a single node host both behave like NUMA_NONE
+void numa_place_dataset(struct NumaDataset* nd, const unsigned int* dataset, uint64_t full_size,
+                        enum NumaMode mode) {
+    nd->mode = mode;
+    nd->ids[0] = 0;
+    nd->nodes = mode == NUMA_NONE ? 1 : numa_nodes(nd->ids);
+    nd->source = dataset;
+    for (int k = 0; k < nd->nodes; k++) {
+        nd->replicas[k] = dataset;
+    }
+    if (nd->nodes == 1) {
+        return;
+    }
 
-// sha3 hash function, outputs 32/64 bytes
-// input: x: char * or int *
-//        is: if is_256 != 0, it means sha3_512, otherwise sha3_256
-//        is_list: if is_list != 0, it means x is a int array
-//        size: size of x
-int* sha3(int is_256, void* x, int is_list, int size) {
-    if (is_256) {
-        if (is_list != 0) {
-            return hash_words_list(sha3_256_wrapper, size, (int*)x);
+    unsigned long mask[NUMA_MAX_NODES / 64] = { 0 };
+    if (mode == NUMA_INTERLEAVE) {
+        for (int k = 0; k < nd->nodes; k++) {
+            mask[nd->ids[k] / 64] |= 1UL << (nd->ids[k] % 64);
+        }
+        if (!numa_bind_memory(dataset, full_size, MPOL_INTERLEAVE_MODE, mask)) {
+            printf("Cannot interleave the dataset, pages stay where they are.\n");
         }
-        return hash_words(sha3_256_wrapper, size, (char*)x);
+        return;
+    }
+
+    // the source serves the first node itself
+    mask[nd->ids[0] / 64] = 1UL << (nd->ids[0] % 64);
+    if (!numa_bind_memory(dataset, full_size, MPOL_BIND_MODE, mask)) {
+        printf("Cannot move the dataset to node %d.\n", nd->ids[0]);
     }
-    else {
-        if (is_list != 0) {
-            return hash_words_list(sha3_512_wrapper, size, (int*)x);
+    for (int k = 1; k < nd->nodes; k++) {
+        unsigned int* copy = alloc_nodes(full_size / HASH_BYTES);
+        memset(mask, 0, sizeof(mask));
+        mask[nd->ids[k] / 64] = 1UL << (nd->ids[k] % 64);
+        // before the copy touches any page, so each one is faulted in on its node
+        if (!numa_bind_memory(copy, full_size, MPOL_BIND_MODE, mask)) {
+            printf("Cannot bind the replica to node %d.\n", nd->ids[k]);
         }
-        return hash_words(sha3_512_wrapper, size, (char*)x);
+        memcpy(copy, dataset, full_size);
+        nd->replicas[k] = copy;
     }
 }
 
-
-struct Block {
-    int number;
-};
-
-int fnv(int v1, int v2) {
-    return v1 * FNV_PRIME ^ v2;
+// free the replicas made by numa_place_dataset(), the source dataset stays
+void numa_release_dataset(struct NumaDataset* nd, uint64_t full_size) {
+    for (int k = 0; k < nd->nodes; k++) {
+        if (nd->replicas[k] != nd->source) {
+            free_nodes((unsigned int*)nd->replicas[k], full_size / HASH_BYTES);
+        }
+    }
 }
 
+
 // generate one element in dataset
-// input: cache: int array, generated by mkcache
-//        len: length of cache
+// input: out: 16 words to store the element
+//        cache: flat word array, generated by mkcache
+//        len: number of nodes in cache
 //        i: index of this element in dataset
-// output: int array
-unsigned int* calc_dataset_item(unsigned int** cache, int len, int i) {
+void calc_dataset_item(unsigned int* out, const unsigned int* cache, int len, int i) {
     int r = HASH_BYTES / WORD_BYTES;
     // initialize the mix
     unsigned int mix[16];
-    memcpy(mix, cache[i % len], 64);
+    memcpy(mix, cache + (size_t)(i % len) * NODE_WORDS, 64);
     mix[0] ^= i;
-
-    // sha3 malloc int array, so need to free it
-    unsigned int* temp = sha3(0, mix, 1, 64);
-    memcpy(mix, temp, 64);
-    free(temp);
+    sha3_512_node(mix, mix);
 
     // fnv it with a lot of random cache nodes based on i
     for (int j = 0; j < DATASET_PARENTS; j++) {
-        int cache_index = fnv(i ^ j, mix[j % r]);
+        unsigned int cache_index = fnv(i ^ j, mix[j % r]);
+        const unsigned int* parent = cache + (size_t)(cache_index % len) * NODE_WORDS;
 
         for (int k = 0; k < 16; k++) {
-            mix[k] = fnv(mix[k], cache[cache_index % len][k]);
+            mix[k] = fnv(mix[k], parent[k]);
         }
 
     }
 
-    return sha3(0, mix, 1, 64);
-}
-
-// generate (typically 1GB) dataset based on (typically 16MB) cache
-// input: full_size: dataset size
-//        cache: int array, generated by mkcache
-//        cache_size: size of cache
-// output: int array
-unsigned int** calc_dataset(int full_size, unsigned int** cache, int cache_size) {
-    int loop_times = full_size / HASH_BYTES;
-    unsigned int** o = malloc(sizeof(int*) * loop_times);
-
-    for (int i = 0; i < loop_times; i++) {
-        o[i] = calc_dataset_item(cache, cache_size / 64, i);
-    }
-
-    return o;
+    sha3_512_node(out, mix);
 }
 
+// same as calc_dataset_item(), for count (<= HASH_BATCH) consecutive items
+// starting at start, so both sha3_512 steps go through the multi-buffer Keccak
+// input: out: count * 16 words to store the items
+static inline __attribute__((always_inline))
+void calc_dataset_items_kernel(unsigned int* out, const unsigned int* cache, int len, int start, int count) {
+    int r = HASH_BYTES / WORD_BYTES;
+    unsigned int mix[HASH_BATCH][16];
 
-// generate cache
-// input: cache size and seed
-// output: int array
-unsigned int** mkcache(int cache_size, char* seed) {
-    int n = cache_size / HASH_BYTES;
-
-    // Sequentially produce the initial dataset
-    unsigned int** o = malloc(sizeof(int*) * n);
-    o[0] = sha3(0, seed, 0, 32);
-
-    for (int i = 1; i < n; i++) {
-        o[i] = sha3(0, o[i - 1], 1, 64);
+    for (int b = 0; b < count; b++) {
+        int i = start + b;
+        memcpy(mix[b], cache + (size_t)(i % len) * NODE_WORDS, 64);
+        mix[b][0] ^= i;
     }
+    keccak_512_batch(mix, mix, HASH_BYTES, count);
 
-    // Use a low - round version of randmemohash
-    for (int i = 0; i < CACHE_ROUNDS; i++) {
-        for (int j = 0; j < n; j++) {
-            unsigned int v = o[j][0] % n;
+    for (int j = 0; j < DATASET_PARENTS; j++) {
+        for (int b = 0; b < count; b++) {
+            unsigned int cache_index = fnv((start + b) ^ j, mix[b][j % r]);
+            const unsigned int* parent = cache + (size_t)(cache_index % len) * NODE_WORDS;
 
-            // map xor over o[(i - 1 + n) % n], o[v]
-            unsigned int temp[16];
             for (int k = 0; k < 16; k++) {
-                temp[k] = o[(j - 1 + n) % n][k] ^ o[v][k];
+                mix[b][k] = fnv(mix[b][k], parent[k]);
             }
-            o[j] = sha3(0, temp, 1, 64);
         }
     }
 
-    return o;
+    keccak_512_batch(out, mix, HASH_BYTES, count);
 }
 
-// aggregate data from the full dataset 
-// to produce final result for given header and nonce
-// main loop of the algorithm
-// if dataset is NULL, will use file "dataset" instead
-char* hashimoto_full(int full_size, unsigned int** dataset, char* header, int header_size, 
-                     uint64_t nonce, FILE* fp) {
-    int n = full_size / HASH_BYTES;
-    int w = MIX_BYTES / WORD_BYTES;
-    int mixhashes = MIX_BYTES / HASH_BYTES;
+void calc_dataset_items(unsigned int* out, const unsigned int* cache, int len, int start, int count) {
+    kernels->dataset_items(out, cache, len, start, count);
+}
 
-    // combine header + nonce into a 64 byte seed
-    char* nonce_encoded = encode_int64(nonce);
-    char seed[header_size + 8];
-    for (int i = 0; i < header_size; i++) {
-        seed[i] = header[i];
+// resolve a requested thread count
+// input: requested: wanted number of threads, <= 0 means one per online core
+// output: number of threads to start (at least 1)
+int resolve_threads(int requested) {
+    if (requested > 0) {
+        return requested;
     }
 
-    for (int i = 0; i < 8; i++) {
-        seed[header_size + i] = nonce_encoded[8 - 1 - i];
-    }
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    return cores > 0 ? (int)cores : 1;
+}
 
-    int* s = sha3(0, seed, 0, header_size + 8);
 
-    // start the mix with replicated s
-    int mix[w];
-    for (int i = 0; i < mixhashes; i++) {
-        for (int j = 0; j < 16; j++) {
-            mix[i*16 + j] = s[j];
+// run worker(job) on threads threads sharing one job and wait for all
+// the calling thread is one of them; if some threads cannot be created,
+// the work is simply shared by fewer threads
+// input: threads: number of threads, already resolved
+void run_shared(int threads, void* worker(void*), void* job) {
+    pthread_t tid[threads];
+    int started = 1;
+    for (; started < threads; started++) {
+        if (pthread_create(&tid[started], NULL, worker, job) != 0) {
+            break;
         }
     }
 
-    // mix in random dataset nodes
-    for (int i = 0; i < ACCESSES; i++) {
-        int p = fnv(i ^ s[0], mix[i % w]) % (n / mixhashes) * mixhashes;
+    worker(job);
 
-        int newdata[w];
+    for (int i = 1; i < started; i++) {
+        pthread_join(tid[i], NULL);
+    }
+}
 
-        for (int j = 0; j < mixhashes; j++) {
-            // look up 64 bytes in dataset
-            if (!dataset) {
-                fseek(fp, (p + j) * 64, SEEK_SET);
-                if (fread(newdata + (j * 16), sizeof(int), 16, fp) != 16) {
-                    printf("File read error.");
-                    exit(0);
-                }
-            }
-            else {
-                int* slices = dataset[p + j];
-                for (int k = 0; k < 16; k++) {
-                    newdata[j * 16 + k] = slices[k];
-                }
-            }
+
+
+// shared state of one calc_dataset() run
+struct DatasetJob {
+    unsigned int* dataset;  // receives items first .. first + items - 1
+    const unsigned int* cache;
+    int cache_len;       // number of nodes in cache
+    int first;           // index of the first item to make
+    int items;           // number of items to make
+    int next;            // next unclaimed item (relative to first), advanced atomically
+};
+
+// generator thread: keep claiming GEN_CHUNK items until none is left,
+// so faster cores simply take more chunks and nobody is left straggling
+void* calc_dataset_worker(void* arg) {
+    struct DatasetJob* job = arg;
+
+    for (;;) {
+        int start = __atomic_fetch_add(&job->next, GEN_CHUNK, __ATOMIC_RELAXED);
+        if (start >= job->items) {
+            break;
         }
 
-        // map(fnv, mix, newdata)
-        for (int j = 0; j < w; j++) {
-            mix[j] = fnv(mix[j], newdata[j]);
+        int end = start + GEN_CHUNK < job->items ? start + GEN_CHUNK : job->items;
+        for (int i = start; i < end; i += HASH_BATCH) {
+            int count = end - i < HASH_BATCH ? end - i : HASH_BATCH;
+            calc_dataset_items(job->dataset + (size_t)i * NODE_WORDS, job->cache, job->cache_len,
+                               job->first + i, count);
         }
+        count_add(COUNT_ITEMS, end - start);
     }
 
-    // compress mixs
-    // header_size + 8 is the size of s
-    // which will be combined with cmix
-    // so researve space in advance
-    int offset = header_size + 8;
-    int cmix[offset + (w / 4)];
-    for (int i = 0; i < w/4; i++) {
-        int k = i * 4;
-        cmix[offset + i] = fnv(fnv(fnv(mix[k], mix[k + 1]), mix[k + 2]), mix[k + 3]);
+    return NULL;
+}
+
+// make dataset items first .. first + count - 1 into out
+// every item only depends on the read-only cache, so items are spread
+// over threads; output is identical whatever the thread count is
+// input: out: count * 16 words
+//        cache: flat word array, generated by mkcache
+//        cache_size: size of cache
+//        threads: number of generator threads, <= 0 means one per online core
+void calc_dataset_range(unsigned int* out, const unsigned int* cache, uint64_t cache_size,
+                        int first, int count, int threads) {
+    struct DatasetJob job;
+    job.dataset = out;
+    job.cache = cache;
+    job.cache_len = cache_size / HASH_BYTES;
+    job.first = first;
+    job.items = count;
+    job.next = 0;
+
+    run_shared(resolve_threads(threads), calc_dataset_worker, &job);
+}
+
+// generate (typically 1GB) dataset based on (typically 16MB) cache
+// input: full_size: dataset size
+//        cache: flat word array, generated by mkcache
+//        cache_size: size of cache
+//        threads: number of generator threads, <= 0 means one per online core
+// output: flat word array, item i starts at word i * NODE_WORDS
+unsigned int* calc_dataset(uint64_t full_size, const unsigned int* cache, uint64_t cache_size, int threads) {
+    double begin = now_seconds();
+    int items = full_size / HASH_BYTES;
+    unsigned int* o = alloc_nodes(items);
+    generation_started(items, 0);
+    calc_dataset_range(o, cache, cache_size, 0, items, threads);
+    phase_done(PHASE_CALC_DATASET, begin);
+    return o;
+}
+
+
+// generate cache into o, entirely in place: every node is hashed from
+// nodes already in o, nothing is allocated and no temporary is kept
+// input: o: cache_size bytes, e.g. from alloc_nodes()
+//        cache size and seed
+void mkcache_into(unsigned int* o, uint64_t cache_size, const unsigned char* seed) {
+    double begin = now_seconds();
+    unsigned int n = cache_size / HASH_BYTES;
+
+    // Sequentially produce the initial dataset
+    keccak_512(o, seed, 32);
+
+    for (unsigned int i = 1; i < n; i++) {
+        sha3_512_node(o + (size_t)i * NODE_WORDS, o + (size_t)(i - 1) * NODE_WORDS);
     }
 
-    // copy s to cmix
-    for (int i = 0; i < offset; i++) {
-        cmix[i] = s[i];
+    // Use a low - round version of randmemohash
+    for (int i = 0; i < CACHE_ROUNDS; i++) {
+        for (unsigned int j = 0; j < n; j++) {
+            unsigned int* node = o + (size_t)j * NODE_WORDS;
+            unsigned int v = node[0] % n;
+            const unsigned int* prev = o + (size_t)(j ? j - 1 : n - 1) * NODE_WORDS;
+            const unsigned int* other = o + (size_t)v * NODE_WORDS;
+
+            // o[j] = sha3_512(o[j - 1 mod n] xor o[v]), xored into o[j] itself
+            // since it is overwritten anyway; word k of each node is read
+            // before word k of o[j] is written, so v == j is fine too
+            for (int k = 0; k < NODE_WORDS; k++) {
+                node[k] = prev[k] ^ other[k];
+            }
+            sha3_512_node(node, node);
+        }
     }
-    free(s);
 
-    int *temp = sha3(1, cmix, 1, offset + (w / 4));
-    char *result = serialize_hash(temp, 8);
-    free(temp);
+    phase_done(PHASE_MKCACHE, begin);
+}
 
-    return result;
+// generate cache
+// input: cache size and seed
+// output: flat word array, node i starts at word i * NODE_WORDS
+unsigned int* mkcache(uint64_t cache_size, const unsigned char* seed) {
+    unsigned int* o = alloc_nodes(cache_size / HASH_BYTES);
+    mkcache_into(o, cache_size, seed);
+    return o;
 }
 
+// output of hashimoto, see "mix digest" and "result" in the spec
+struct HashResult {
+    unsigned char mix_digest[32];  // compressed mix
+    unsigned char result[32];      // sha3_256(s + cmix), compared against target
+};
 
+// combine header + nonce (8 bytes, little endian) into the seed
+// input: seed: header_size + 8 bytes
+void hashimoto_seed(unsigned char* seed, const char* header, int header_size, uint64_t nonce) {
+    memcpy(seed, header, header_size);
+    for (int i = 0; i < 8; i++) {
+        seed[header_size + i] = (unsigned char)(nonce >> (8 * i));
+    }
+}
 
-// generate seedhash based on block number
-// input: block struct
-char* get_seedhash(struct Block block) {
-    char* s = malloc(32);
-    for (int i = 0; i < 32; i++) {
-        s[i] = '\0';
+// 8 words of the mix: one AVX2 register, or two SSE registers otherwise
+typedef unsigned int mix_vec __attribute__((vector_size(8 * WORD_BYTES)));
+typedef int mix_vec_mask __attribute__((vector_size(8 * WORD_BYTES)));
+#define MIX_VECS (MIX_WORDS / 8)
+
+// map(fnv, mix, newdata), newdata is the 128 byte page at page
+static inline __attribute__((always_inline)) void mix_page(mix_vec* mix, const unsigned int* page) {
+    for (int v = 0; v < MIX_VECS; v++) {
+        mix_vec newdata;
+        memcpy(&newdata, page + v * 8, sizeof(mix_vec));
+        mix[v] = mix[v] * FNV_PRIME ^ newdata;
     }
+}
 
-    // no need to implement this for block.number = 1
-    // for (int i = 0; i < block.number / EPOCH_LENGTH; i++) {
-    //     s = 
-    // }
-    return s;
+// compress mixs: cmix[i] = fnv(fnv(fnv(mix[4i], mix[4i+1]), mix[4i+2]), mix[4i+3])
+// input: cmix: MIX_WORDS / 4 words
+static inline __attribute__((always_inline)) void mix_compress(unsigned int* cmix, const mix_vec* mix) {
+    // transpose so that lane i of m0..m3 holds mix[4i]..mix[4i+3]
+    const mix_vec_mask even = { 0, 4, 8, 12, 1, 5, 9, 13 };
+    const mix_vec_mask odd = { 2, 6, 10, 14, 3, 7, 11, 15 };
+    const mix_vec_mask lo = { 0, 1, 2, 3, 8, 9, 10, 11 };
+    const mix_vec_mask hi = { 4, 5, 6, 7, 12, 13, 14, 15 };
+    mix_vec t01 = __builtin_shuffle(mix[0], mix[1], even);
+    mix_vec t23 = __builtin_shuffle(mix[2], mix[3], even);
+    mix_vec u01 = __builtin_shuffle(mix[0], mix[1], odd);
+    mix_vec u23 = __builtin_shuffle(mix[2], mix[3], odd);
+    mix_vec m0 = __builtin_shuffle(t01, t23, lo);
+    mix_vec m1 = __builtin_shuffle(t01, t23, hi);
+    mix_vec m2 = __builtin_shuffle(u01, u23, lo);
+    mix_vec m3 = __builtin_shuffle(u01, u23, hi);
+    mix_vec c = ((m0 * FNV_PRIME ^ m1) * FNV_PRIME ^ m2) * FNV_PRIME ^ m3;
+    memcpy(cmix, &c, sizeof(c));
 }
 
+// index of the page read by access i: fnv(i ^ s[0], mix[i % w]) in whole pages,
+// as the node index of its first half
+static inline __attribute__((always_inline)) unsigned int mix_page_index(const mix_vec* mix, const unsigned int* s, int i, unsigned int pages) {
+    int w = MIX_BYTES / WORD_BYTES;
+    int mixhashes = MIX_BYTES / HASH_BYTES;
+    return fnv(i ^ s[0], mix[(i % w) / 8][i % 8]) % pages * mixhashes;
+}
 
-// mine a block
-// input: full_size: size of dataset
-//        dataset: int array, it is it null, will looking for file "dataset"
-//        header: header of the block
-//        difficulty: difficulty to mine the block
-// output: nonce, if not found in given times, return 0
-// Note: difficulty is acutally a fixed number in this function, see comment below
-uint64_t mine(int full_size, unsigned int** dataset, char* header, int header_size, int difficulty) {
-    // in python: "2 ** 256 // difficulty"
-    // no int256 support in C, so difficulty actually is fixed in this program
-    // TODO: should be fixed in the future
-    // currently can only do this calculation by hand
-    int target = 1;
-
-    // randint(0, 2 ** 64)
-    init_genrand64(0);
-    uint64_t nonce = genrand64_int64();
+// hint both cache lines of the page starting at node p
+static inline __attribute__((always_inline)) void prefetch_page(const unsigned int* dataset, unsigned int p) {
+    const unsigned int* page = dataset + (size_t)p * NODE_WORDS;
+    // read once: non-temporal, keeps it out of the outer caches
+    __builtin_prefetch(page, 0, 0);
+    __builtin_prefetch(page + NODE_WORDS, 0, 0);
+}
 
-    int i = 0;
-    unsigned int result;
+// the dataset access loop of hashimoto
+// the mix lives in MIX_VECS vector registers: every access is a 128 byte
+// load, a 32-wide FNV and the next page index is taken from the registers
+// input: s_cmix: s (16 words) = sha3_512(seed), cmix (w / 4 words) is
+//        written right behind it, so the whole buffer is the input of
+//        the final sha3_256
+static inline __attribute__((always_inline))
+void hashimoto_mix_kernel(unsigned int* s_cmix, uint64_t full_size, const unsigned int* dataset) {
+    unsigned int pages = full_size / MIX_BYTES;
+    const unsigned int* s = s_cmix;
+    unsigned int* cmix = s_cmix + NODE_WORDS;
 
-    // exisiting dataset will be used if dataset = NULL
-    FILE* fp = NULL;
-    if (!dataset) {
-        if ((fp = fopen("dataset", "rb")) == NULL) {
-            printf("Cannot open file.\n");
-            return 0;
-        }
+    // start the mix with replicated s
+    mix_vec mix[MIX_VECS];
+    for (int v = 0; v < MIX_VECS; v++) {
+        memcpy(&mix[v], s + (v * 8) % NODE_WORDS, sizeof(mix_vec));
     }
 
-    do {
-        if (i >= TIME_LIMIT) {
-            printf("tried %d times without finding solution, give up.\n", i);
-            return 0;
-        }
+    // mix in random dataset nodes
+    for (int i = 0; i < ACCESSES; i++) {
+        unsigned int p = mix_page_index(mix, s, i, pages);
+        mix_page(mix, dataset + (size_t)p * NODE_WORDS);
+    }
 
-        result = decode_int(hashimoto_full(full_size, dataset, header, header_size, nonce, fp));
-        // in python "nonce = (nonce + 1) % 2 ** 64"
-        // no need to do the mod by exploiting the overflow in uint64_t
-        nonce += 1;
-        i += 1;
+    mix_compress(cmix, mix);
+}
 
-#ifdef PRINT_RESULT
-        printf("%x\n", result);
-#endif
-    } while (1);
+void hashimoto_mix(unsigned int* s_cmix, uint64_t full_size, const unsigned int* dataset) {
+    kernels->mix(s_cmix, full_size, dataset);
+}
 
-    printf("tried %d times. Found solution with nonce = %lx\n", i, nonce);
+// hashimoto_mix() for count (<= HASH_BATCH) hashes kept in flight together
+// a single hash waits for every page read, as the next index depends on the
+// mix just updated; here the hashes advance round robin, one access each,
+// and the next page of a hash is prefetched as soon as its index is known,
+// so count dataset reads overlap instead of one at a time
+// input: s_cmix: count buffers laid out as for hashimoto_mix()
+static inline __attribute__((always_inline))
+void hashimoto_mix_batch_kernel(unsigned int (*s_cmix)[DIGEST_WORDS], int count, uint64_t full_size,
+                                const unsigned int* dataset) {
+    unsigned int pages = full_size / MIX_BYTES;
+    mix_vec mix[HASH_BATCH][MIX_VECS];
+    unsigned int p[HASH_BATCH];
+
+    for (int b = 0; b < count; b++) {
+        for (int v = 0; v < MIX_VECS; v++) {
+            memcpy(&mix[b][v], s_cmix[b] + (v * 8) % NODE_WORDS, sizeof(mix_vec));
+        }
+        p[b] = mix_page_index(mix[b], s_cmix[b], 0, pages);
+        prefetch_page(dataset, p[b]);
+    }
 
-    if (!dataset) {
-        fclose(fp);
+    for (int i = 0; i < ACCESSES; i++) {
+        for (int b = 0; b < count; b++) {
+            mix_page(mix[b], dataset + (size_t)p[b] * NODE_WORDS);
+            if (i + 1 < ACCESSES) {
+                p[b] = mix_page_index(mix[b], s_cmix[b], i + 1, pages);
+                prefetch_page(dataset, p[b]);
+            }
+        }
     }
-    return nonce;
-}
 
+    for (int b = 0; b < count; b++) {
+        mix_compress(s_cmix[b] + NODE_WORDS, mix[b]);
+    }
+}
 
-// Run the whole algorithm
-// gen cache -> gen dataset -> mine on dataset
-void test_whole_algortihm() {
-    int header_size = 508 + 8 * 5;
+void hashimoto_mix_batch(unsigned int (*s_cmix)[DIGEST_WORDS], int count, uint64_t full_size,
+                         const unsigned int* dataset) {
+    kernels->mix_batch(s_cmix, count, full_size, dataset);
+}
 
-    struct Block block = { 1 };
 
-    // create byte array with header_size
-    char* header = malloc(header_size);
-    for (int i = 0; i < header_size; i++) {
-        header[i] = '\0';
+// the kernels above are always inlined into one copy per instruction set,
+// so the same source compiles to SSE2, AVX2 or AVX-512 code
+#define KERNEL_VARIANT(variant, target) \
+    target static void calc_dataset_items_##variant(unsigned int* out, const unsigned int* cache, \
+                                                    int len, int start, int count) { \
+        calc_dataset_items_kernel(out, cache, len, start, count); \
+    } \
+    target static void hashimoto_mix_##variant(unsigned int* s_cmix, uint64_t full_size, \
+                                               const unsigned int* dataset) { \
+        hashimoto_mix_kernel(s_cmix, full_size, dataset); \
+    } \
+    target static void hashimoto_mix_batch_##variant(unsigned int (*s_cmix)[DIGEST_WORDS], int count, \
+                                                     uint64_t full_size, const unsigned int* dataset) { \
+        hashimoto_mix_batch_kernel(s_cmix, count, full_size, dataset); \
     }
 
-    // difficulty in genesis block
-    // Credit: https://lightrains.com/blogs/setup-local-ethereum-blockchain-private-testnet
-    int difficulty = 0x4000;
+KERNEL_VARIANT(generic, )
 
-    int cache_size = CACHE_SIZE;
-    int full_size = DATASET_SIZE;
-    char* seedhash = get_seedhash(block);
-    printf("Target: make dataset and mine it.\n");
-    printf("Step (1/3): Make cache (around 16MB)... \n");
-    unsigned int** cache = mkcache(cache_size, seedhash);
-    printf("Step (1/3) finished.\n");
-    printf("Step (2/3): Make dataset (around 1GB)... May takes several hours to do so\n");
-    unsigned int** dataset = calc_dataset(full_size, cache, cache_size);
-    printf("Step (2/3) finished.\n");
-    printf("Step (3/3) mine a block...\n");
-    uint64_t nonce = mine(full_size, dataset, header, header_size, difficulty);
-    printf("Step (3/3) finished.\n");
-    printf("\nProgram ends.\n");
+int baseline_supported() {
+    return 1;
 }
 
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && !defined(__clang__)
+#define X86_KERNELS
+KERNEL_VARIANT(avx2, __attribute__((target("avx2"))))
+KERNEL_VARIANT(avx512, __attribute__((target("avx512f,avx512vl"))))
 
-// generate and save dataset to file "dataset" for future use
-void save_dataset() {
-    int header_size = 508 + 8 * 5;
+int avx2_supported() {
+    return __builtin_cpu_supports("avx2");
+}
 
-    struct Block block = { 1 };
+int avx512_supported() {
+    return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vl");
+}
+#endif
 
-    // create byte array with header_size
-    char* header = malloc(header_size);
-    for (int i = 0; i < header_size; i++) {
+const struct Kernels kernel_variants[] = {
+    // fastest first
+#ifdef X86_KERNELS
+    { "avx512", avx512_supported, calc_dataset_items_avx512, hashimoto_mix_avx512, hashimoto_mix_batch_avx512 },
+    { "avx2", avx2_supported, calc_dataset_items_avx2, hashimoto_mix_avx2, hashimoto_mix_batch_avx2 },
+#endif
+    { "generic", baseline_supported, calc_dataset_items_generic, hashimoto_mix_generic, hashimoto_mix_batch_generic },
+};
+
+// the mix loop of hashimoto word by word, as written in the spec
+// only used to check the kernels
+void hashimoto_mix_reference(unsigned int* s_cmix, uint64_t full_size, const unsigned int* dataset) {
+    unsigned int n = full_size / HASH_BYTES;
+    int w = MIX_BYTES / WORD_BYTES;
+    int mixhashes = MIX_BYTES / HASH_BYTES;
+    const unsigned int* s = s_cmix;
+
+    unsigned int mix[MIX_WORDS];
+    for (int k = 0; k < w; k++) {
+        mix[k] = s[k % NODE_WORDS];
+    }
+    for (int i = 0; i < ACCESSES; i++) {
+        unsigned int p = fnv(i ^ s[0], mix[i % w]) % (n / mixhashes) * mixhashes;
+        for (int k = 0; k < w; k++) {
+            mix[k] = fnv(mix[k], dataset[(size_t)p * NODE_WORDS + k]);
+        }
+    }
+    for (int k = 0; k < w; k += 4) {
+        s_cmix[NODE_WORDS + k / 4] = fnv(fnv(fnv(mix[k], mix[k + 1]), mix[k + 2]), mix[k + 3]);
+    }
+}
+
+// sha3_256 of the outputs of hashimoto_mix_reference() and of
+// calc_dataset_item() on the inputs of kernels_selftest()
+const unsigned char mix_known_answer[32] = {
+    0x0d, 0xdb, 0x26, 0xd4, 0xef, 0x08, 0xed, 0x18, 0x93, 0x5e, 0x77, 0x9f, 0x06, 0x21, 0xe1, 0x20,
+    0x81, 0xaf, 0x78, 0x90, 0xfc, 0xcc, 0x1b, 0xb8, 0xb4, 0x5a, 0x6b, 0x44, 0xc3, 0x19, 0x52, 0x85
+};
+const unsigned char items_known_answer[32] = {
+    0x47, 0xbf, 0xec, 0xc7, 0xa4, 0x5f, 0xd6, 0xae, 0xb0, 0xa2, 0xa2, 0xad, 0x74, 0xf6, 0xf4, 0xc2,
+    0xf4, 0x44, 0x92, 0x78, 0x2c, 0xee, 0x85, 0xe8, 0xc3, 0x2d, 0xa8, 0xb4, 0x95, 0x19, 0x0f, 0x3b
+};
+
+// known-answer test of a kernel variant on a small made up dataset and
+// cache: the batch and single kernels must match the word by word
+// reference and the scalar calc_dataset_item(), whose outputs must hash
+// to the known answers
+int kernels_selftest(const struct Kernels* k) {
+    enum { PAGES = 256, CACHE_NODES = 61 };
+    unsigned int dataset[PAGES * MIX_WORDS];
+    unsigned int cache[CACHE_NODES * NODE_WORDS];
+    unsigned int s_cmix[HASH_BATCH][DIGEST_WORDS];
+    unsigned int want[HASH_BATCH][DIGEST_WORDS];
+    unsigned int items[HASH_BATCH][NODE_WORDS];
+    unsigned int want_items[HASH_BATCH][NODE_WORDS];
+    unsigned char digest[32];
+
+    unsigned int x = 1;
+    for (int i = 0; i < PAGES * MIX_WORDS; i++) {
+        dataset[i] = x = fnv(x, i);
+    }
+    for (int i = 0; i < CACHE_NODES * NODE_WORDS; i++) {
+        cache[i] = x = fnv(x, i);
+    }
+    for (int b = 0; b < HASH_BATCH; b++) {
+        for (int i = 0; i < DIGEST_WORDS; i++) {
+            want[b][i] = s_cmix[b][i] = x = fnv(x, b);
+        }
+        hashimoto_mix_reference(want[b], PAGES * MIX_BYTES, dataset);
+    }
+    keccak_256(digest, want, sizeof(want));
+    if (memcmp(digest, mix_known_answer, 32) != 0) {
+        return 0;
+    }
+
+    k->mix_batch(s_cmix, HASH_BATCH, PAGES * MIX_BYTES, dataset);
+    if (memcmp(s_cmix, want, sizeof(want)) != 0) {
+        return 0;
+    }
+    for (int b = 0; b < HASH_BATCH; b++) {
+        memset(s_cmix[b] + NODE_WORDS, 0, (DIGEST_WORDS - NODE_WORDS) * WORD_BYTES);
+        k->mix(s_cmix[b], PAGES * MIX_BYTES, dataset);
+    }
+    if (memcmp(s_cmix, want, sizeof(want)) != 0) {
+        return 0;
+    }
+
+    for (int b = 0; b < HASH_BATCH; b++) {
+        calc_dataset_item(want_items[b], cache, CACHE_NODES, 1000 + b);
+    }
+    keccak_256(digest, want_items, sizeof(want_items));
+    if (memcmp(digest, items_known_answer, 32) != 0) {
+        return 0;
+    }
+    k->dataset_items(items[0], cache, CACHE_NODES, 1000, HASH_BATCH);
+    return memcmp(items, want_items, sizeof(items)) == 0;
+}
+
+// pick the fastest kernels the cpu supports (cpuid) and that pass their
+// known-answer test; runs once at startup, after lib/sha3.c made its choice
+__attribute__((constructor(102))) void select_kernels() {
+#ifdef X86_KERNELS
+    __builtin_cpu_init();
+#endif
+    int count = sizeof(kernel_variants) / sizeof(kernel_variants[0]);
+    for (int i = 0; i < count; i++) {
+        const struct Kernels* k = &kernel_variants[i];
+        if (!k->supported()) {
+            continue;
+        }
+        if (!kernels_selftest(k)) {
+            fprintf(stderr, "%s kernels failed their self-check, not used.\n", k->name);
+            continue;
+        }
+        kernels = k;
+        return;
+    }
+    fprintf(stderr, "No kernels passed their self-check.\n");
+    abort();
+}
+
+// same as hashimoto_mix(), but every page is computed from the cache
+// with calc_dataset_item() instead of being read from the dataset
+// input: cache_len: number of nodes in cache
+void hashimoto_mix_light(unsigned int* s_cmix, uint64_t full_size, const unsigned int* cache, int cache_len) {
+    unsigned int pages = full_size / MIX_BYTES;
+    int mixhashes = MIX_BYTES / HASH_BYTES;
+    const unsigned int* s = s_cmix;
+    unsigned int* cmix = s_cmix + NODE_WORDS;
+
+    // start the mix with replicated s
+    mix_vec mix[MIX_VECS];
+    for (int v = 0; v < MIX_VECS; v++) {
+        memcpy(&mix[v], s + (v * 8) % NODE_WORDS, sizeof(mix_vec));
+    }
+
+    // mix in dataset nodes made on demand
+    for (int i = 0; i < ACCESSES; i++) {
+        unsigned int p = mix_page_index(mix, s, i, pages);
+        unsigned int page[MIX_WORDS];
+        calc_dataset_items(page, cache, cache_len, p, mixhashes);
+        mix_page(mix, page);
+    }
+
+    mix_compress(cmix, mix);
+}
+
+// aggregate data from the full dataset 
+// to produce final result for given header and nonce
+// main loop of the algorithm
+// dataset is either in memory or a file mapped by map_dataset()
+// output is written to out, nothing is allocated
+void hashimoto_full(struct HashResult* out, uint64_t full_size, const unsigned int* dataset,
+                    const char* header, int header_size, uint64_t nonce) {
+    unsigned char seed[header_size + 8];
+    hashimoto_seed(seed, header, header_size, nonce);
+
+    unsigned int s_cmix[DIGEST_WORDS];
+    keccak_512(s_cmix, seed, header_size + 8);
+    hashimoto_mix(s_cmix, full_size, dataset);
+    count_add(COUNT_HASHES, 1);
+    count_add(COUNT_DAG_READS, ACCESSES);
+
+    memcpy(out->mix_digest, s_cmix + NODE_WORDS, sizeof(out->mix_digest));
+    keccak_256(out->result, s_cmix, sizeof(s_cmix));
+}
+
+// same as hashimoto_full(), for count (<= HASH_BATCH) consecutive nonces
+// starting at nonce, both sha3 steps go through the multi-buffer Keccak
+// and the dataset reads of all count nonces overlap, see hashimoto_mix_batch()
+// input: out: count results
+void hashimoto_full_batch(struct HashResult* out, uint64_t full_size, const unsigned int* dataset,
+                          const char* header, int header_size, uint64_t nonce, int count) {
+    unsigned char seeds[HASH_BATCH][header_size + 8];
+    unsigned int s[HASH_BATCH][NODE_WORDS];
+    unsigned int s_cmix[HASH_BATCH][DIGEST_WORDS];
+    unsigned char results[HASH_BATCH][32];
+
+    for (int b = 0; b < count; b++) {
+        hashimoto_seed(seeds[b], header, header_size, nonce + b);
+    }
+    keccak_512_batch(s, seeds, header_size + 8, count);
+
+    for (int b = 0; b < count; b++) {
+        memcpy(s_cmix[b], s[b], sizeof(s[b]));
+    }
+    hashimoto_mix_batch(s_cmix, count, full_size, dataset);
+    count_add(COUNT_HASHES, count);
+    count_add(COUNT_DAG_READS, (uint64_t)count * ACCESSES);
+    keccak_256_batch(results, s_cmix, sizeof(s_cmix[0]), count);
+
+    for (int b = 0; b < count; b++) {
+        memcpy(out[b].mix_digest, s_cmix[b] + NODE_WORDS, sizeof(out[b].mix_digest));
+        memcpy(out[b].result, results[b], sizeof(out[b].result));
+    }
+}
+
+
+
+// light client version of hashimoto_full()
+// only needs the cache, the 128 dataset items touched by this hash are
+// computed on demand; output is identical to hashimoto_full()
+// input: cache: flat word array, generated by mkcache
+//        cache_size: size of cache
+void hashimoto_light(struct HashResult* out, uint64_t full_size, const unsigned int* cache, uint64_t cache_size,
+                     const char* header, int header_size, uint64_t nonce) {
+    unsigned char seed[header_size + 8];
+    hashimoto_seed(seed, header, header_size, nonce);
+
+    unsigned int s_cmix[DIGEST_WORDS];
+    keccak_512(s_cmix, seed, header_size + 8);
+    hashimoto_mix_light(s_cmix, full_size, cache, cache_size / HASH_BYTES);
+    count_add(COUNT_HASHES, 1);
+
+    memcpy(out->mix_digest, s_cmix + NODE_WORDS, sizeof(out->mix_digest));
+    keccak_256(out->result, s_cmix, sizeof(s_cmix));
+}
+
+
+
+// test x for primality by trial division
+// only used for epochs beyond the precomputed tables in sizes.h
+int isprime(uint64_t x) {
+    if (x < 2) {
+        return 0;
+    }
+    for (uint64_t i = 2; i * i <= x; i++) {
+        if (x % i == 0) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// cache size in bytes for the epoch of block_number
+// the largest size below the linear growth line whose number of 64 byte
+// nodes is prime; a table lookup for the first SIZE_TABLE_EPOCHS epochs
+uint64_t get_cache_size(uint64_t block_number) {
+    uint64_t epoch = block_number / EPOCH_LENGTH;
+    if (epoch < SIZE_TABLE_EPOCHS) {
+        return cache_sizes[epoch];
+    }
+
+    uint64_t sz = CACHE_BYTES_INIT + (uint64_t)CACHE_BYTES_GROWTH * epoch;
+    sz -= HASH_BYTES;
+    while (!isprime(sz / HASH_BYTES)) {
+        sz -= 2 * HASH_BYTES;
+    }
+    return sz;
+}
+
+// dataset size in bytes for the epoch of block_number
+// same rule as get_cache_size(), counted in 128 byte mix pages
+uint64_t get_full_size(uint64_t block_number) {
+    uint64_t epoch = block_number / EPOCH_LENGTH;
+    if (epoch < SIZE_TABLE_EPOCHS) {
+        return dataset_sizes[epoch];
+    }
+
+    uint64_t sz = DATASET_BYTES_INIT + (uint64_t)DATASET_BYTES_GROWTH * epoch;
+    sz -= MIX_BYTES;
+    while (!isprime(sz / MIX_BYTES)) {
+        sz -= 2 * MIX_BYTES;
+    }
+    return sz;
+}
+
+// generate seedhash based on block number
+// 32 zero bytes hashed with sha3_256 once per epoch
+// input: seed: 32 bytes to store the seedhash
+void get_seedhash(unsigned char* seed, uint64_t block_number) {
+    memset(seed, 0, 32);
+    for (uint64_t i = 0; i < block_number / EPOCH_LENGTH; i++) {
+        keccak_256(seed, seed, 32);
+    }
+}
+
+
+// everything the epoch of a block determines
+struct Epoch {
+    uint64_t epoch;  // block number / EPOCH_LENGTH
+    uint64_t cache_size;
+    uint64_t full_size;
+    unsigned char seedhash[32];
+};
+
+// fill epoch for block, honoring the --cache-size / --dag-size overrides
+void get_epoch(struct Epoch* epoch, struct Block block) {
+    epoch->epoch = block.number / EPOCH_LENGTH;
+    epoch->cache_size = get_cache_size(block.number);
+    epoch->full_size = get_full_size(block.number);
+    if (options.cache_size) {
+        epoch->cache_size = options.cache_size;
+    }
+    if (options.dag_size) {
+        epoch->full_size = options.dag_size;
+    }
+    get_seedhash(epoch->seedhash, block.number);
+}
+
+
+// Dataset file layout (version DAG_VERSION):
+//   [0, sizeof(struct DagFileHeader))  header below, host byte order
+//   [payload_offset, + items * 64)     the dataset items, as in memory
+// payload_offset is a multiple of any page size, so the items can be
+// mapped directly; a file is only used if its header matches the epoch
+#define DAG_MAGIC "CETHDAG"      // 8 bytes with the terminating '\0'
+#define DAG_VERSION 2
+#define DAG_ENDIAN 0x01020304    // reads differently on a host of other byte order
+#define DAG_PAYLOAD_OFFSET 65536
+
+struct DagFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t endian;
+    uint64_t epoch;
+    uint64_t items;                 // number of 64 byte items
+    uint64_t cache_size;            // bytes of the cache the items were made from
+    uint64_t payload_offset;
+    unsigned char seedhash[32];
+    unsigned char cache_hash[32];   // sha3_256 of the cache the items were made from
+};
+
+// fill the header of the dataset file of epoch made from cache
+void make_dag_header(struct DagFileHeader* h, const struct Epoch* epoch, const unsigned int* cache) {
+    memset(h, 0, sizeof(*h));
+    memcpy(h->magic, DAG_MAGIC, sizeof(h->magic));
+    h->version = DAG_VERSION;
+    h->endian = DAG_ENDIAN;
+    h->epoch = epoch->epoch;
+    h->items = epoch->full_size / HASH_BYTES;
+    h->cache_size = epoch->cache_size;
+    h->payload_offset = DAG_PAYLOAD_OFFSET;
+    memcpy(h->seedhash, epoch->seedhash, 32);
+    keccak_256(h->cache_hash, cache, epoch->cache_size);
+}
+
+// check that a dataset file header belongs to epoch
+// input: cache_hash: sha3_256 of the epoch's cache, NULL to skip that check
+// output: 1 if the file can be used, 0 otherwise (reason is printed)
+int check_dag_header(const struct DagFileHeader* h, const struct Epoch* epoch,
+                     const unsigned char* cache_hash) {
+    if (memcmp(h->magic, DAG_MAGIC, sizeof(h->magic)) != 0) {
+        printf("Not a dataset file.\n");
+        return 0;
+    }
+    if (h->endian != DAG_ENDIAN) {
+        printf("Dataset file was written on a host of other byte order.\n");
+        return 0;
+    }
+    if (h->version != DAG_VERSION) {
+        printf("Dataset file version %u, expected %u.\n", h->version, DAG_VERSION);
+        return 0;
+    }
+    if (h->epoch != epoch->epoch || memcmp(h->seedhash, epoch->seedhash, 32) != 0) {
+        printf("Dataset file is for epoch %" PRIu64 ", expected %" PRIu64 ".\n", h->epoch, epoch->epoch);
+        return 0;
+    }
+    if (h->items != epoch->full_size / HASH_BYTES) {
+        printf("Dataset file has %" PRIu64 " items, expected %" PRIu64 ".\n",
+               h->items, epoch->full_size / HASH_BYTES);
+        return 0;
+    }
+    if (h->cache_size != epoch->cache_size) {
+        printf("Dataset file was made from a cache of %" PRIu64 " bytes, expected %" PRIu64 ".\n",
+               h->cache_size, epoch->cache_size);
+        return 0;
+    }
+    if (h->payload_offset % sysconf(_SC_PAGESIZE) != 0) {
+        printf("Dataset file payload is not page aligned.\n");
+        return 0;
+    }
+    if (cache_hash && memcmp(h->cache_hash, cache_hash, 32) != 0) {
+        printf("Dataset file was made from another cache.\n");
+        return 0;
+    }
+    return 1;
+}
+
+// progress of generate_dataset_file(), kept next to the file as
+// <path>.journal until the file is complete
+struct DagJournal {
+    struct DagFileHeader header;  // header the finished file will get
+    uint64_t done;                // items [0, done) are durable in the file
+};
+
+// replace the journal atomically: write a temporary file, then rename it
+int write_journal(const char* journal, const struct DagJournal* j) {
+    char tmp[strlen(journal) + 5];
+    snprintf(tmp, sizeof(tmp), "%s.tmp", journal);
+
+    int fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        return 0;
+    }
+    int ok = write(fd, j, sizeof(*j)) == sizeof(*j) && fdatasync(fd) == 0;
+    close(fd);
+    return ok && rename(tmp, journal) == 0;
+}
+
+// recompute SPOT_CHECKS items spread over [0, done) and compare them with
+// the file, to make sure the journal can be trusted
+// output: 1 if all of them match
+int spot_check_dataset(int fd, const struct DagJournal* j, const unsigned int* cache, uint64_t cache_size) {
+    for (int k = 0; k < SPOT_CHECKS; k++) {
+        uint64_t i = (j->done - 1) * k / (SPOT_CHECKS - 1);
+        unsigned int expected[NODE_WORDS], stored[NODE_WORDS];
+
+        calc_dataset_item(expected, cache, cache_size / HASH_BYTES, i);
+        count_add(COUNT_FILE_READS, 1);
+        count_add(COUNT_FILE_READ_BYTES, HASH_BYTES);
+        if (pread(fd, stored, HASH_BYTES, j->header.payload_offset + i * HASH_BYTES) != HASH_BYTES ||
+            memcmp(expected, stored, HASH_BYTES) != 0) {
+            printf("Item %" PRIu64 " in the file is wrong.\n", i);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// generate the dataset of epoch straight into the file at path
+// items are made CHECKPOINT_ITEMS at a time, written, synced and then
+// recorded in <path>.journal, so an interrupted run resumes from the last
+// durable item; the header is written last, a file without it is never
+// accepted by map_dataset()
+// output: 1 on success, 0 otherwise
+int generate_dataset_file(const char* path, const struct Epoch* epoch, const unsigned int* cache, int threads) {
+    char journal[strlen(path) + 9];
+    snprintf(journal, sizeof(journal), "%s.journal", path);
+
+    struct DagJournal j;
+    make_dag_header(&j.header, epoch, cache);
+    j.done = 0;
+
+    int fd = open(path, O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+        printf("Cannot open file.\n");
+        return 0;
+    }
+
+    // resume if the journal is for this very dataset and the file agrees with it
+    struct DagJournal old;
+    int jfd = open(journal, O_RDONLY);
+    if (jfd >= 0) {
+        count_add(COUNT_FILE_READS, 1);
+        count_add(COUNT_FILE_READ_BYTES, sizeof(old));
+        if (read(jfd, &old, sizeof(old)) == sizeof(old) &&
+            memcmp(&old.header, &j.header, sizeof(j.header)) == 0 &&
+            old.done > 0 && old.done <= j.header.items) {
+            if (spot_check_dataset(fd, &old, cache, epoch->cache_size)) {
+                printf("Resuming at item %" PRIu64 " of %" PRIu64 ".\n", old.done, j.header.items);
+                j.done = old.done;
+            }
+            else {
+                printf("Starting over.\n");
+            }
+        }
+        close(jfd);
+    }
+
+    // invalidate the header of a previous complete file before touching it
+    struct DagFileHeader blank;
+    memset(&blank, 0, sizeof(blank));
+    if (pwrite(fd, &blank, sizeof(blank), 0) != sizeof(blank) ||
+        ftruncate(fd, j.header.payload_offset + j.header.items * HASH_BYTES) != 0) {
+        printf("File write error.\n");
+        close(fd);
+        return 0;
+    }
+
+    double begin = now_seconds();
+    generation_started(j.header.items, j.done);
+    uint64_t chunk = CHECKPOINT_ITEMS < j.header.items ? CHECKPOINT_ITEMS : j.header.items;
+    unsigned int* buf = alloc_nodes(chunk);
+
+    while (j.done < j.header.items) {
+        int count = j.header.items - j.done < chunk ? j.header.items - j.done : chunk;
+        calc_dataset_range(buf, cache, epoch->cache_size, j.done, count, threads);
+
+        size_t bytes = (size_t)count * HASH_BYTES;
+        if (pwrite(fd, buf, bytes, j.header.payload_offset + j.done * HASH_BYTES) != (ssize_t)bytes ||
+            fdatasync(fd) != 0) {
+            printf("File write error.\n");
+            break;
+        }
+
+        j.done += count;
+        if (!write_journal(journal, &j)) {
+            printf("Cannot write journal %s.\n", journal);
+            break;
+        }
+        printf("%" PRIu64 "/%" PRIu64 " items written\n", j.done, j.header.items);
+    }
+    free_nodes(buf, chunk);
+    phase_done(PHASE_CALC_DATASET, begin);
+
+    int ok = j.done == j.header.items &&
+             pwrite(fd, &j.header, sizeof(j.header), 0) == sizeof(j.header) &&
+             fdatasync(fd) == 0;
+    close(fd);
+
+    if (ok) {
+        unlink(journal);
+    }
+    return ok;
+}
+
+// map the items of a dataset file read-only as a flat word array
+// only the header is read up front, so a stale or foreign file is
+// rejected at once and the items are faulted in on first touch
+// input: path: file written by generate_dataset_file()
+//        epoch: epoch the file must belong to
+//        cache_hash: sha3_256 of the epoch's cache when it is at hand, else NULL
+//        lock: if != 0, fault in and pin every page with mlock
+// output: word array, NULL on failure; release with unmap_dataset()
+const unsigned int* map_dataset(const char* path, const struct Epoch* epoch,
+                                const unsigned char* cache_hash, int lock) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        printf("Cannot open file.\n");
+        return NULL;
+    }
+
+    struct DagFileHeader h;
+    count_add(COUNT_FILE_READS, 1);
+    count_add(COUNT_FILE_READ_BYTES, sizeof(h));
+    if (pread(fd, &h, sizeof(h), 0) != sizeof(h) || !check_dag_header(&h, epoch, cache_hash)) {
+        close(fd);
+        return NULL;
+    }
+
+    size_t bytes = h.items * HASH_BYTES;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (uint64_t)st.st_size < h.payload_offset + bytes) {
+        printf("File %s is truncated.\n", path);
+        close(fd);
+        return NULL;
+    }
+
+    void* p = mmap(NULL, bytes, PROT_READ, MAP_SHARED, fd, h.payload_offset);
+    // the mapping keeps its own reference on the file
+    close(fd);
+    if (p == MAP_FAILED) {
+        printf("Cannot map file %s.\n", path);
+        return NULL;
+    }
+
+    // hashimoto reads 128 bytes at random offsets, so readahead is wasted
+    madvise(p, bytes, MADV_RANDOM);
+
+    if (lock && mlock(p, bytes) != 0) {
+        printf("Cannot lock dataset in memory, pages will be faulted on demand.\n");
+    }
+
+    return p;
+}
+
+void unmap_dataset(const unsigned int* p, size_t bytes) {
+    munmap((void*)p, bytes);
+}
+
+
+// Cache file layout (version CACHE_FILE_VERSION), <dir>/cache-<seedhash>-<size>:
+//   [0, sizeof(struct CacheFileHeader))  header below, host byte order
+//   [CACHE_PAYLOAD_OFFSET, + size)       the cache nodes, as in memory
+//   then room for a NodesTrailer, so the mapped nodes are freed like any
+//   other buffer of alloc_nodes()
+// mkcache() is a sequential hash chain, mapping a saved cache back skips
+// it entirely; the file is only used if seedhash, size and checksum match
+#define CACHE_MAGIC "CETHCCH"     // 8 bytes with the terminating '\0'
+#define CACHE_FILE_VERSION 1
+#define CACHE_PAYLOAD_OFFSET 65536
+#define CACHE_PATH_EXTRA 45       // bytes a cache file path takes beyond its directory
+
+struct CacheFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t endian;                // DAG_ENDIAN
+    uint64_t size;                  // cache size in bytes
+    uint64_t payload_offset;
+    unsigned char seedhash[32];
+    unsigned char checksum[32];     // sha3_256 of the cache
+};
+
+// <dir>/cache-<hex of the first 8 bytes of seedhash>-<cache size>
+// the size is part of the name, so caches shrunk by --cache-size never
+// replace the full size cache of the same epoch
+// input: path: strlen(dir) + CACHE_PATH_EXTRA bytes
+void cache_file_path(char* path, const char* dir, uint64_t cache_size, const unsigned char* seedhash) {
+    int len = sprintf(path, "%s/cache-", dir);
+    for (int i = 0; i < 8; i++) {
+        len += sprintf(path + len, "%02x", seedhash[i]);
+    }
+    sprintf(path + len, "-%" PRIu64, cache_size);
+}
+
+// map the cache of seedhash saved in dir, privately, so the nodes can be
+// released with free_nodes() like a cache made by mkcache()
+// output: flat word array, NULL if there is no matching file
+unsigned int* map_cache_file(const char* dir, uint64_t cache_size, const unsigned char* seedhash) {
+    char path[strlen(dir) + CACHE_PATH_EXTRA];
+    cache_file_path(path, dir, cache_size, seedhash);
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return NULL;
+    }
+
+    struct CacheFileHeader h;
+    size_t len = CACHE_PAYLOAD_OFFSET + cache_size + sizeof(struct NodesTrailer);
+    struct stat st;
+    count_add(COUNT_FILE_READS, 1);
+    count_add(COUNT_FILE_READ_BYTES, sizeof(h));
+    if (pread(fd, &h, sizeof(h), 0) != sizeof(h) || memcmp(h.magic, CACHE_MAGIC, sizeof(h.magic)) != 0 ||
+        h.version != CACHE_FILE_VERSION || h.endian != DAG_ENDIAN || h.size != cache_size ||
+        h.payload_offset != CACHE_PAYLOAD_OFFSET || memcmp(h.seedhash, seedhash, 32) != 0 ||
+        fstat(fd, &st) != 0 || (uint64_t)st.st_size < len) {
+        close(fd);
+        return NULL;
+    }
+
+    size_t map_len = len - CACHE_PAYLOAD_OFFSET;
+    void* p = mmap(NULL, map_len, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, CACHE_PAYLOAD_OFFSET);
+    // the mapping keeps its own reference on the file
+    close(fd);
+    if (p == MAP_FAILED) {
+        return NULL;
+    }
+    count_add(COUNT_FILE_READS, 1);
+    count_add(COUNT_FILE_READ_BYTES, cache_size);
+
+    unsigned char checksum[32];
+    keccak_256(checksum, p, cache_size);
+    if (memcmp(checksum, h.checksum, 32) != 0) {
+        munmap(p, map_len);
+        return NULL;
+    }
+
+    // only the page of the trailer is copied on write
+    struct NodesTrailer* t = (struct NodesTrailer*)((char*)p + cache_size);
+    t->map_len = map_len;
+    t->mode = PAGES_FILE;
+    return p;
+}
+
+// save cache to dir (made if missing) for map_cache_file()
+// the file is written under a temporary name and renamed, so concurrent
+// savers and readers never see a partial file
+// output: 1 on success
+int save_cache_file(const char* dir, uint64_t cache_size, const unsigned char* seedhash, const unsigned int* cache) {
+    char path[strlen(dir) + CACHE_PATH_EXTRA];
+    char tmp[sizeof(path) + 7];
+    cache_file_path(path, dir, cache_size, seedhash);
+    snprintf(tmp, sizeof(tmp), "%s.XXXXXX", path);
+
+    mkdir(dir, 0755);
+    int fd = mkstemp(tmp);
+    if (fd < 0) {
+        return 0;
+    }
+
+    struct CacheFileHeader h;
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, CACHE_MAGIC, sizeof(h.magic));
+    h.version = CACHE_FILE_VERSION;
+    h.endian = DAG_ENDIAN;
+    h.size = cache_size;
+    h.payload_offset = CACHE_PAYLOAD_OFFSET;
+    memcpy(h.seedhash, seedhash, 32);
+    keccak_256(h.checksum, cache, cache_size);
+
+    off_t len = CACHE_PAYLOAD_OFFSET + cache_size + sizeof(struct NodesTrailer);
+    int ok = fchmod(fd, 0644) == 0 && pwrite(fd, &h, sizeof(h), 0) == sizeof(h) &&
+             pwrite(fd, cache, cache_size, CACHE_PAYLOAD_OFFSET) == (ssize_t)cache_size &&
+             ftruncate(fd, len) == 0 && fdatasync(fd) == 0;
+    close(fd);
+    if (!ok || rename(tmp, path) != 0) {
+        unlink(tmp);
+        return 0;
+    }
+    return 1;
+}
+
+// same as mkcache(), but maps the cache saved in dir if it matches, and
+// saves a newly made one there for the next run
+// input: dir: cache directory, NULL to always make the cache
+unsigned int* load_cache(const char* dir, uint64_t cache_size, const unsigned char* seedhash) {
+    unsigned int* cache = dir ? map_cache_file(dir, cache_size, seedhash) : NULL;
+    if (!cache) {
+        cache = mkcache(cache_size, seedhash);
+        if (dir && !save_cache_file(dir, cache_size, seedhash, cache)) {
+            printf("Cannot save the cache to %s.\n", dir);
+        }
+    }
+    return cache;
+}
+
+
+// a light cache of one epoch, handed out read-only by a CacheManager
+struct LightCache {
+    uint64_t epoch;
+    struct Epoch params;
+    unsigned int* cache;  // NULL while it is being built
+    int refs;             // handles given out, +1 while resident in the manager
+    uint64_t last_used;   // manager tick of the last acquire, for LRU
+};
+
+// keeps the light caches of the CACHE_SLOTS most recently used epochs
+// so verifiers around an epoch boundary do not rebuild them
+struct CacheManager {
+    pthread_mutex_t lock;
+    pthread_cond_t built;  // broadcast whenever a cache finished building
+    struct LightCache* slots[CACHE_SLOTS];
+    uint64_t tick;
+};
+
+void cache_manager_init(struct CacheManager* m) {
+    pthread_mutex_init(&m->lock, NULL);
+    pthread_cond_init(&m->built, NULL);
+    for (int i = 0; i < CACHE_SLOTS; i++) {
+        m->slots[i] = NULL;
+    }
+    m->tick = 0;
+}
+
+// drop one reference, free the cache with the last one
+// must hold m->lock
+void light_cache_unref(struct LightCache* c) {
+    if (--c->refs == 0) {
+        free_nodes(c->cache, c->params.cache_size / HASH_BYTES);
+        free(c);
+    }
+}
+
+// get a read-only handle on the light cache of block's epoch
+// a resident cache is returned at once; a missing one is built by the
+// first caller while concurrent callers for the same epoch wait for it
+// output: handle, give it back with release_light_cache()
+const struct LightCache* acquire_light_cache(struct CacheManager* m, struct Block block) {
+    uint64_t epoch = block.number / EPOCH_LENGTH;
+
+    pthread_mutex_lock(&m->lock);
+    m->tick += 1;
+
+    struct LightCache* c = NULL;
+    for (int i = 0; i < CACHE_SLOTS; i++) {
+        if (m->slots[i] && m->slots[i]->epoch == epoch) {
+            c = m->slots[i];
+            break;
+        }
+    }
+
+    if (c) {
+        c->refs += 1;
+        c->last_used = m->tick;
+        while (!c->cache) {
+            pthread_cond_wait(&m->built, &m->lock);
+        }
+        pthread_mutex_unlock(&m->lock);
+        return c;
+    }
+
+    // take a free slot, or evict the least recently used epoch;
+    // handles still out keep an evicted cache alive until released
+    int slot = 0;
+    for (int i = 0; i < CACHE_SLOTS; i++) {
+        if (!m->slots[i]) {
+            slot = i;
+            break;
+        }
+        if (m->slots[i]->last_used < m->slots[slot]->last_used) {
+            slot = i;
+        }
+    }
+    if (m->slots[slot]) {
+        light_cache_unref(m->slots[slot]);
+    }
+
+    c = malloc(sizeof(struct LightCache));
+    c->epoch = epoch;
+    get_epoch(&c->params, block);
+    c->cache = NULL;
+    c->refs = 2;  // the manager and this caller
+    c->last_used = m->tick;
+    m->slots[slot] = c;
+
+    // build outside the lock, other epochs can be served meanwhile
+    pthread_mutex_unlock(&m->lock);
+    unsigned int* cache = load_cache(options.cache_dir, c->params.cache_size, c->params.seedhash);
+
+    pthread_mutex_lock(&m->lock);
+    c->cache = cache;
+    pthread_cond_broadcast(&m->built);
+    pthread_mutex_unlock(&m->lock);
+    return c;
+}
+
+void release_light_cache(struct CacheManager* m, const struct LightCache* handle) {
+    pthread_mutex_lock(&m->lock);
+    light_cache_unref((struct LightCache*)handle);
+    pthread_mutex_unlock(&m->lock);
+}
+
+// release every resident cache, no handle may be outstanding
+void cache_manager_destroy(struct CacheManager* m) {
+    for (int i = 0; i < CACHE_SLOTS; i++) {
+        if (m->slots[i]) {
+            light_cache_unref(m->slots[i]);
+            m->slots[i] = NULL;
+        }
+    }
+    pthread_cond_destroy(&m->built);
+    pthread_mutex_destroy(&m->lock);
+}
+
+
+// one of the two datasets of a DagBuffers
+struct DagSlot {
+    uint64_t epoch;
+    struct Epoch params;
+    unsigned int* dataset;  // NULL if the slot is empty
+    int readers;            // mining threads currently hashing on this slot
+};
+
+// double buffered dataset: miners hash on the active slot while the
+// next epoch is built into the other one by background threads
+// dag_pregenerate() and dag_advance() are driven by one controlling thread
+struct DagBuffers {
+    struct DagSlot slots[2];
+    struct DagSlot* active;  // switched atomically by dag_advance()
+    pthread_t generator;
+    int generating;          // generator has been started and not joined yet
+};
+
+// wait until no mining thread reads slot any more
+void dag_drain(struct DagSlot* slot) {
+    while (__atomic_load_n(&slot->readers, __ATOMIC_SEQ_CST) != 0) {
+        sched_yield();
+    }
+}
+
+// pin the active slot for one batch of hashes
+// the slot cannot be recycled before dag_release()
+struct DagSlot* dag_acquire(struct DagBuffers* d) {
+    for (;;) {
+        struct DagSlot* slot = __atomic_load_n(&d->active, __ATOMIC_SEQ_CST);
+        __atomic_add_fetch(&slot->readers, 1, __ATOMIC_SEQ_CST);
+        // if a switch happened in between, the generator may not have
+        // seen our reader count, so pin the new slot instead
+        if (__atomic_load_n(&d->active, __ATOMIC_SEQ_CST) == slot) {
+            return slot;
+        }
+        __atomic_sub_fetch(&slot->readers, 1, __ATOMIC_SEQ_CST);
+    }
+}
+
+void dag_release(struct DagSlot* slot) {
+    __atomic_sub_fetch(&slot->readers, 1, __ATOMIC_SEQ_CST);
+}
+
+// build the dataset of slot->epoch
+void dag_build(struct DagSlot* slot, int threads) {
+    struct Block block = { slot->epoch * EPOCH_LENGTH };
+    get_epoch(&slot->params, block);
+    unsigned int* cache = load_cache(options.cache_dir, slot->params.cache_size, slot->params.seedhash);
+    slot->dataset = calc_dataset(slot->params.full_size, cache, slot->params.cache_size, threads);
+    free_nodes(cache, slot->params.cache_size / HASH_BYTES);
+}
+
+// background generator, its threads run at PREGEN_NICE
+void* dag_generator(void* arg) {
+    struct DagSlot* slot = arg;
+
+    // nice is per thread on Linux and inherited by the threads calc_dataset starts
+    setpriority(PRIO_PROCESS, syscall(SYS_gettid), PREGEN_NICE);
+    dag_build(slot, options.pregen_threads);
+    return NULL;
+}
+
+// build the dataset of block's epoch in the foreground and make it active
+void dag_buffers_init(struct DagBuffers* d, struct Block block) {
+    for (int i = 0; i < 2; i++) {
+        d->slots[i].dataset = NULL;
+        d->slots[i].readers = 0;
+    }
+    d->slots[0].epoch = block.number / EPOCH_LENGTH;
+    dag_build(&d->slots[0], options.gen_threads);
+    d->active = &d->slots[0];
+    d->generating = 0;
+}
+
+// start building the epoch after the active one into the spare slot
+// returns at once, mining on the active slot goes on meanwhile
+void dag_pregenerate(struct DagBuffers* d) {
+    if (d->generating) {
+        return;
+    }
+
+    struct DagSlot* active = __atomic_load_n(&d->active, __ATOMIC_SEQ_CST);
+    struct DagSlot* spare = active == &d->slots[0] ? &d->slots[1] : &d->slots[0];
+
+    // the spare slot may still hold the previous epoch, which late
+    // batches started before the last switch can be reading
+    dag_drain(spare);
+    if (spare->dataset) {
+        free_nodes(spare->dataset, spare->params.full_size / HASH_BYTES);
+        spare->dataset = NULL;
+    }
+
+    spare->epoch = active->epoch + 1;
+    if (pthread_create(&d->generator, NULL, dag_generator, spare) != 0) {
+        // no background thread, build it right here instead
+        dag_build(spare, options.pregen_threads);
+        return;
+    }
+    d->generating = 1;
+}
+
+// move to the epoch of block once the chain reaches it
+// the active pointer is switched atomically, mining threads pick up the
+// new dataset with their next batch and never stop
+// output: 1 if the active dataset changed, 0 otherwise
+int dag_advance(struct DagBuffers* d, struct Block block) {
+    struct DagSlot* active = __atomic_load_n(&d->active, __ATOMIC_SEQ_CST);
+    struct DagSlot* spare = active == &d->slots[0] ? &d->slots[1] : &d->slots[0];
+    uint64_t epoch = block.number / EPOCH_LENGTH;
+
+    if (epoch == active->epoch) {
+        return 0;
+    }
+
+    // the next epoch should be ready by now; if it is late, this waits for it
+    if (d->generating) {
+        pthread_join(d->generator, NULL);
+        d->generating = 0;
+    }
+    if (!spare->dataset || spare->epoch != epoch) {
+        dag_drain(spare);
+        free_nodes(spare->dataset, spare->params.full_size / HASH_BYTES);
+        spare->epoch = epoch;
+        dag_build(spare, options.gen_threads);
+    }
+
+    __atomic_store_n(&d->active, spare, __ATOMIC_SEQ_CST);
+    return 1;
+}
+
+// no mining may be running
+void dag_buffers_destroy(struct DagBuffers* d) {
+    if (d->generating) {
+        pthread_join(d->generator, NULL);
+        d->generating = 0;
+    }
+    for (int i = 0; i < 2; i++) {
+        free_nodes(d->slots[i].dataset, d->slots[i].params.full_size / HASH_BYTES);
+        d->slots[i].dataset = NULL;
+    }
+}
+
+
+// a 256 bit boundary, words[0] is the most significant 64 bits
+struct Target {
+    uint64_t words[4];
+};
+
+// in python: "2 ** 256 // difficulty"
+// long division of 2 ** 256 (a 1 followed by four zero words) by difficulty,
+// one 64 bit word at a time through a 128 bit intermediate
+// difficulty 0 and 1 give the largest boundary, which every hash meets
+void get_target(struct Target* target, uint64_t difficulty) {
+    if (difficulty <= 1) {
+        memset(target->words, 0xff, sizeof(target->words));
+        return;
+    }
+    unsigned __int128 rem = 1;
+    for (int i = 0; i < 4; i++) {
+        unsigned __int128 cur = rem << 64;
+        target->words[i] = (uint64_t)(cur / difficulty);
+        rem = cur % difficulty;
+    }
+}
+
+// word i of a 32 byte hash read as a big endian 256 bit number
+static inline uint64_t hash_word(const unsigned char* hash, int i) {
+    uint64_t w = 0;
+    for (int b = 0; b < 8; b++) {
+        w = w << 8 | hash[i * 8 + b];
+    }
+    return w;
+}
+
+// hash <= target, given its already loaded most significant word h0
+static inline int meets_target(const unsigned char* hash, uint64_t h0, const struct Target* target) {
+    if (h0 != target->words[0]) {
+        return h0 < target->words[0];
+    }
+    for (int i = 1; i < 4; i++) {
+        uint64_t h = hash_word(hash, i);
+        if (h != target->words[i]) {
+            return h < target->words[i];
+        }
+    }
+    return 1;
+}
+
+#define MEETS_SHARE 1
+#define MEETS_BLOCK 2
+
+// compare a final hash against the pool share and the network boundaries
+// in one pass; block must not be above share
+// almost every hash is rejected by its first word against the share boundary
+// output: MEETS_SHARE and MEETS_BLOCK bits
+static inline int check_targets(const unsigned char* hash, const struct Target* share, const struct Target* block) {
+    uint64_t h0 = hash_word(hash, 0);
+    if (!meets_target(hash, h0, share)) {
+        return 0;
+    }
+    return MEETS_SHARE | (meets_target(hash, h0, block) ? MEETS_BLOCK : 0);
+}
+
+
+// libcethash, see cethash.h
+// the contexts only hold what the epoch determines; nothing below touches
+// a global, so contexts can be shared by threads and made side by side
+
+struct CethashLight {
+    uint64_t epoch;
+    uint64_t cache_size;
+    uint64_t full_size;
+    unsigned int* cache;
+};
+
+struct CethashFull {
+    uint64_t epoch;
+    uint64_t full_size;
+    unsigned int* dataset;
+};
+
+struct CethashLight* cethash_light_load(uint64_t block_number, const char* dir) {
+    struct CethashLight* light = malloc(sizeof(struct CethashLight));
+    if (!light) {
+        return NULL;
+    }
+    light->epoch = block_number / EPOCH_LENGTH;
+    light->cache_size = get_cache_size(block_number);
+    light->full_size = get_full_size(block_number);
+
+    unsigned char seedhash[32];
+    get_seedhash(seedhash, block_number);
+    light->cache = dir ? map_cache_file(dir, light->cache_size, seedhash) : NULL;
+    if (light->cache) {
+        return light;
+    }
+
+    light->cache = try_alloc_nodes(light->cache_size / HASH_BYTES);
+    if (!light->cache) {
+        free(light);
+        return NULL;
+    }
+    mkcache_into(light->cache, light->cache_size, seedhash);
+    if (dir) {
+        save_cache_file(dir, light->cache_size, seedhash, light->cache);
+    }
+    return light;
+}
+
+struct CethashLight* cethash_light_new(uint64_t block_number) {
+    return cethash_light_load(block_number, NULL);
+}
+
+void cethash_light_free(struct CethashLight* light) {
+    if (light) {
+        free_nodes(light->cache, light->cache_size / HASH_BYTES);
+        free(light);
+    }
+}
+
+struct CethashFull* cethash_full_new(const struct CethashLight* light, int threads) {
+    struct CethashFull* full = malloc(sizeof(struct CethashFull));
+    if (!full) {
+        return NULL;
+    }
+    full->epoch = light->epoch;
+    full->full_size = light->full_size;
+    full->dataset = try_alloc_nodes(full->full_size / HASH_BYTES);
+    if (!full->dataset) {
+        free(full);
+        return NULL;
+    }
+    calc_dataset_range(full->dataset, light->cache, light->cache_size, 0, full->full_size / HASH_BYTES, threads);
+    return full;
+}
+
+void cethash_full_free(struct CethashFull* full) {
+    if (full) {
+        free_nodes(full->dataset, full->full_size / HASH_BYTES);
+        free(full);
+    }
+}
+
+uint64_t cethash_light_epoch(const struct CethashLight* light) {
+    return light->epoch;
+}
+
+uint64_t cethash_light_cache_size(const struct CethashLight* light) {
+    return light->cache_size;
+}
+
+uint64_t cethash_full_dag_size(const struct CethashFull* full) {
+    return full->full_size;
+}
+
+// struct CethashResult is the public twin of struct HashResult
+static void copy_result(struct CethashResult* out, const struct HashResult* hash) {
+    memcpy(out->mix_digest, hash->mix_digest, sizeof(out->mix_digest));
+    memcpy(out->result, hash->result, sizeof(out->result));
+}
+
+// hashimoto keeps header + nonce in stack arrays (HASH_BATCH of them when
+// batched), so the length a caller passes must be bounded
+static int header_size_ok(int header_size) {
+    return header_size >= 0 && header_size <= CETHASH_MAX_HEADER;
+}
+
+int cethash_light_compute(const struct CethashLight* light, const char* header, int header_size,
+                          uint64_t nonce, struct CethashResult* out) {
+    if (!header_size_ok(header_size)) {
+        return 0;
+    }
+    struct HashResult hash;
+    hashimoto_light(&hash, light->full_size, light->cache, light->cache_size, header, header_size, nonce);
+    copy_result(out, &hash);
+    return 1;
+}
+
+int cethash_full_compute(const struct CethashFull* full, const char* header, int header_size,
+                         uint64_t nonce, struct CethashResult* out) {
+    if (!header_size_ok(header_size)) {
+        return 0;
+    }
+    struct HashResult hash;
+    hashimoto_full(&hash, full->full_size, full->dataset, header, header_size, nonce);
+    copy_result(out, &hash);
+    return 1;
+}
+
+int cethash_verify(const struct CethashLight* light, const char* header, int header_size,
+                   uint64_t nonce, const unsigned char* mix_digest, uint64_t difficulty) {
+    if (!header_size_ok(header_size)) {
+        return 0;
+    }
+    struct HashResult hash;
+    hashimoto_light(&hash, light->full_size, light->cache, light->cache_size, header, header_size, nonce);
+    if (memcmp(hash.mix_digest, mix_digest, sizeof(hash.mix_digest)) != 0) {
+        return 0;
+    }
+    struct Target target;
+    get_target(&target, difficulty);
+    return meets_target(hash.result, hash_word(hash.result, 0), &target);
+}
+
+// HASH_BATCH nonces at a time, as mine_worker() does
+int cethash_search(const struct CethashFull* full, const char* header, int header_size,
+                   uint64_t start, uint64_t count, uint64_t difficulty,
+                   uint64_t* nonce, struct CethashResult* out) {
+    if (!header_size_ok(header_size)) {
+        return 0;
+    }
+    struct Target target;
+    get_target(&target, difficulty);
+
+    struct HashResult hashes[HASH_BATCH];
+    for (uint64_t done = 0; done < count; done += HASH_BATCH) {
+        int batch = count - done < HASH_BATCH ? (int)(count - done) : HASH_BATCH;
+        hashimoto_full_batch(hashes, full->full_size, full->dataset, header, header_size, start + done, batch);
+        for (int b = 0; b < batch; b++) {
+            if (meets_target(hashes[b].result, hash_word(hashes[b].result, 0), &target)) {
+                *nonce = start + done + b;
+                copy_result(out, &hashes[b]);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+
+#ifndef LIBCETHASH
+// everything below is the cethash program: mining runs, demos, benchmarks
+// and the command line, left out of the library
+
+// shared state of one mine() run
+struct MineJob {
+    uint64_t full_size;
+    const unsigned int* dataset;  // in memory or mapped from a dataset file
+    struct DagBuffers* dag;       // if set, replaces full_size and dataset by its active slot
+    const struct NumaDataset* numa;  // if set, replaces dataset by the replica of each thread's node
+    const unsigned int* cache;    // if set, hashes are computed from it instead of a dataset
+    uint64_t cache_size;
+    char* header;
+    int header_size;
+    struct Target share;          // pool share boundary, the same as block when mining solo
+    struct Target block;          // network boundary, a hash below it solves the block
+    const int* stop;              // if set, mine without a nonce budget until *stop != 0,
+                                  // blocks found meanwhile do not end the run
+    uint64_t base;                // first nonce of thread 0, 0 for a random one
+    uint64_t next_base;           // set by run_mine(): base of a next run that goes on from here
+    int found;                    // set once by the first thread with a solution
+    uint64_t nonce;               // winning nonce, valid when found != 0
+};
+
+// per-thread part of a mine() run
+struct MineWorker {
+    struct MineJob* job;
+    uint64_t start;   // first nonce of this thread's range
+    uint64_t budget;  // number of nonces in the range
+    uint64_t tried;   // hashes computed by this thread
+    uint64_t shares;  // of these, hashes meeting the share boundary
+    uint64_t blocks;  // of these, hashes meeting the block boundary
+    int node;         // index into job->numa->ids of the node the thread runs on
+};
+
+// mining thread: walk its own nonce range until it is exhausted,
+// a solution is found, another thread found one, or job->stop is set;
+// with job->stop it goes on past solutions, onto the next nonces
+void* mine_worker(void* arg) {
+    struct MineWorker* w = arg;
+    struct MineJob* job = w->job;
+
+    const unsigned int* dataset = job->dataset;
+    unsigned long saved[NUMA_MASK_LONGS];
+    int bound = 0;
+    if (job->numa) {
+        dataset = job->numa->replicas[w->node];
+    }
+    if (job->numa && job->numa->nodes > 1) {
+        bound = numa_bind_thread(job->numa->ids[w->node], saved);
+    }
+
+    uint64_t nonce = w->start;
+    while (w->tried < w->budget &&
+           !__atomic_load_n(job->stop ? job->stop : &job->found, __ATOMIC_RELAXED)) {
+        int count = w->budget - w->tried < HASH_BATCH ? (int)(w->budget - w->tried) : HASH_BATCH;
+        struct HashResult hash[HASH_BATCH];
+        if (job->dag) {
+            // the active dataset may be switched between two batches
+            struct DagSlot* slot = dag_acquire(job->dag);
+            hashimoto_full_batch(hash, slot->params.full_size, slot->dataset,
+                                 job->header, job->header_size, nonce, count);
+            dag_release(slot);
+        }
+        else if (job->cache) {
+            for (int b = 0; b < count; b++) {
+                hashimoto_light(&hash[b], job->full_size, job->cache, job->cache_size,
+                                job->header, job->header_size, nonce + b);
+            }
+        }
+        else {
+            hashimoto_full_batch(hash, job->full_size, dataset, job->header, job->header_size, nonce, count);
+        }
+        w->tried += count;
+
+        for (int b = 0; b < count; b++) {
+#ifdef PRINT_RESULT
+            printf("%016" PRIx64 "\n", hash_word(hash[b].result, 0));
+#endif
+
+            int meets = check_targets(hash[b].result, &job->share, &job->block);
+            if (meets & MEETS_SHARE) {
+                w->shares++;
+            }
+            if (meets & MEETS_BLOCK) {
+                w->blocks++;
+                int expected = 0;
+                // only the first thread to get here reports its nonce
+                if (__atomic_compare_exchange_n(&job->found, &expected, 1, 0,
+                                                __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)) {
+                    job->nonce = nonce + b;
+                }
+                // found is set by now, which ends the outer loop too
+                if (!job->stop) {
+                    break;
+                }
+            }
+        }
+
+        // in python "nonce = (nonce + 1) % 2 ** 64"
+        // no need to do the mod by exploiting the overflow in uint64_t
+        nonce += count;
+    }
+
+    if (bound) {
+        // the calling thread of run_mine() is a worker too
+        numa_unbind_thread(saved);
+    }
+    return NULL;
+}
+
+// search nonces for job on threads threads
+// the nonce space is split into one disjoint range per thread, and the
+// nonce budget (--nonces) is split between them the same way; with
+// job->stop there is no budget, the threads go on until it is set
+// output: nonce, if not found in given times, return 0
+uint64_t run_mine(struct MineJob* job, int threads) {
+    uint64_t base = job->base;
+    if (!base) {
+        // randint(0, 2 ** 64)
+        init_genrand64(0);
+        base = genrand64_int64();
+    }
+
+    threads = resolve_threads(threads);
+    uint64_t budget = job->stop ? UINT64_MAX : options.nonces;
+    if ((uint64_t)threads > budget) {
+        threads = budget > 0 ? budget : 1;
+    }
+
+    // thread t starts at base + t * (2 ** 64 / threads)
+    uint64_t span = UINT64_MAX / threads;
+    struct MineWorker workers[threads];
+    for (int t = 0; t < threads; t++) {
+        workers[t].job = job;
+        workers[t].start = base + t * span;
+        workers[t].budget = budget / threads + ((uint64_t)t < budget % threads);
+        workers[t].tried = 0;
+        workers[t].shares = 0;
+        workers[t].blocks = 0;
+        // round robin, so every node gets its share of threads
+        workers[t].node = job->numa ? t % job->numa->nodes : 0;
+    }
+
+    double begin = now_seconds();
+    pthread_t tid[threads];
+    int started = 1;
+    for (; started < threads; started++) {
+        if (pthread_create(&tid[started], NULL, mine_worker, &workers[started]) != 0) {
+            break;
+        }
+    }
+    // this thread works on range 0
+    mine_worker(&workers[0]);
+
+    for (int t = 1; t < started; t++) {
+        pthread_join(tid[t], NULL);
+    }
+    double elapsed = now_seconds() - begin;
+    phase_done(PHASE_MINING, begin);
+
+    uint64_t tried = 0;
+    uint64_t shares = 0;
+    uint64_t blocks = 0;
+    uint64_t most = 0;
+    for (int t = 0; t < threads; t++) {
+        tried += workers[t].tried;
+        shares += workers[t].shares;
+        blocks += workers[t].blocks;
+        most = workers[t].tried > most ? workers[t].tried : most;
+    }
+    // every range moves past its furthest thread, so no nonce is tried twice
+    job->next_base = base + most;
+    if (memcmp(&job->share, &job->block, sizeof(job->share)) != 0) {
+        printf("%" PRIu64 " shares found.\n", shares);
+    }
+    if (job->stop && blocks > 1) {
+        printf("%" PRIu64 " blocks found before the stop.\n", blocks);
+    }
+
+    if (job->numa && job->numa->nodes > 1) {
+        for (int k = 0; k < job->numa->nodes; k++) {
+            uint64_t node_tried = 0;
+            int node_threads = 0;
+            for (int t = 0; t < threads; t++) {
+                if (workers[t].node == k) {
+                    node_tried += workers[t].tried;
+                    node_threads++;
+                }
+            }
+            printf("node %d (%s): %" PRIu64 " hashes on %d threads, %.1f H/s\n", job->numa->ids[k],
+                   numa_mode_names[job->numa->mode], node_tried, node_threads,
+                   elapsed > 0 ? node_tried / elapsed : 0.0);
+        }
+    }
+
+    if (!job->found) {
+        printf("tried %" PRIu64 " times on %d threads without finding solution, %s.\n", tried, threads,
+               job->stop ? "stopped" : "give up");
+        return 0;
+    }
+
+    printf("tried %" PRIu64 " times on %d threads. Found solution with nonce = %" PRIx64 "\n",
+           tried, threads, job->nonce);
+    return job->nonce;
+}
+
+// set the boundaries of job, share_difficulty 0 means solo mining
+// a share difficulty above difficulty is lowered to it, every block is a share
+void set_targets(struct MineJob* job, uint64_t difficulty, uint64_t share_difficulty) {
+    if (share_difficulty == 0 || share_difficulty > difficulty) {
+        share_difficulty = difficulty;
+    }
+    get_target(&job->block, difficulty);
+    get_target(&job->share, share_difficulty);
+}
+
+// mine a block
+// input: full_size: size of dataset
+//        dataset: flat word array, in memory or mapped by map_dataset()
+//        header: header of the block
+//        difficulty: difficulty to mine the block
+//        share_difficulty: pool share difficulty, 0 when mining solo
+//        threads: number of mining threads, <= 0 means one per online core
+// output: nonce, if not found in given times, return 0
+uint64_t mine(uint64_t full_size, const unsigned int* dataset, char* header, int header_size,
+              uint64_t difficulty, uint64_t share_difficulty, int threads) {
+    struct MineJob job = { .full_size = full_size, .dataset = dataset, .header = header, .header_size = header_size };
+    set_targets(&job, difficulty, share_difficulty);
+    return run_mine(&job, threads);
+}
+
+// same as mine(), on a dataset placed by numa_place_dataset()
+// threads are spread round robin over the nodes and bound to them,
+// and the hashrate of each node is reported
+uint64_t mine_numa(uint64_t full_size, const struct NumaDataset* numa, char* header, int header_size,
+                   uint64_t difficulty, uint64_t share_difficulty, int threads) {
+    struct MineJob job = { .full_size = full_size, .dataset = numa->source, .numa = numa,
+                           .header = header, .header_size = header_size };
+    set_targets(&job, difficulty, share_difficulty);
+    return run_mine(&job, threads);
+}
+
+// same as mine(), but always on the active dataset of dag, which may
+// move to the next epoch while the threads are hashing
+// input: stop: if not NULL, mine with no nonce budget until *stop is set
+//        base: first nonce, 0 for a random one; set to where a next call
+//              goes on, so consecutive calls never repeat a nonce
+uint64_t mine_live(struct DagBuffers* dag, char* header, int header_size, uint64_t difficulty,
+                   uint64_t share_difficulty, int threads, const int* stop, uint64_t* base) {
+    struct MineJob job = { .dag = dag, .header = header, .header_size = header_size,
+                           .stop = stop, .base = *base };
+    set_targets(&job, difficulty, share_difficulty);
+    uint64_t nonce = run_mine(&job, threads);
+    *base = job.next_base;
+    return nonce;
+}
+
+// same as mine(), with hashes computed from the cache like hashimoto_light()
+uint64_t mine_light(uint64_t full_size, const unsigned int* cache, uint64_t cache_size, char* header,
+                    int header_size, uint64_t difficulty, uint64_t share_difficulty, int threads) {
+    struct MineJob job = { .full_size = full_size, .cache = cache, .cache_size = cache_size,
+                           .header = header, .header_size = header_size };
+    set_targets(&job, difficulty, share_difficulty);
+    return run_mine(&job, threads);
+}
+
+
+// one share to verify: a header hash, its nonce and the claimed mix digest
+struct VerifyItem {
+    char header[32];
+    uint64_t nonce;
+    unsigned char mix_digest[32];
+};
+
+// shared state of one verify_batch() run
+struct VerifyJob {
+    uint64_t full_size;
+    const unsigned int* dataset;  // if NULL, pages are computed from cache
+    const unsigned int* cache;
+    uint64_t cache_size;
+    const struct VerifyItem* items;
+    char* pass;
+    int count;
+    int next;                     // next unclaimed item, advanced atomically
+};
+
+// verifier thread: claim small runs of items until none is left
+void* verify_worker(void* arg) {
+    struct VerifyJob* job = arg;
+    int chunk = HASH_BATCH;
+
+    for (;;) {
+        int start = __atomic_fetch_add(&job->next, chunk, __ATOMIC_RELAXED);
+        if (start >= job->count) {
+            break;
+        }
+
+        int end = start + chunk < job->count ? start + chunk : job->count;
+        for (int i = start; i < end; i++) {
+            const struct VerifyItem* item = &job->items[i];
+            struct HashResult hash;
+
+            if (job->dataset) {
+                hashimoto_full(&hash, job->full_size, job->dataset, item->header, 32, item->nonce);
+            }
+            else {
+                hashimoto_light(&hash, job->full_size, job->cache, job->cache_size,
+                                item->header, 32, item->nonce);
+            }
+
+            job->pass[i] = memcmp(hash.mix_digest, item->mix_digest, 32) == 0;
+        }
+    }
+
+    return NULL;
+}
+
+// verify many shares of one epoch at once
+// the dataset (or the cache when dataset is NULL) is shared read-only by
+// all threads
+// input: full_size: size of dataset
+//        dataset: flat word array, NULL to verify from the cache instead
+//        cache, cache_size: cache of the epoch, only used if dataset is NULL
+//        items: count shares to verify
+//        pass: count flags, set to 1 if the share's mix digest is right, 0 otherwise
+//        threads: number of threads, <= 0 means one per online core
+// output: number of shares that passed
+int verify_batch(uint64_t full_size, const unsigned int* dataset, const unsigned int* cache, uint64_t cache_size,
+                 const struct VerifyItem* items, char* pass, int count, int threads) {
+    struct VerifyJob job = { full_size, dataset, cache, cache_size, items, pass, count, 0 };
+
+    threads = resolve_threads(threads);
+    double start = now_seconds();
+    run_shared(threads, verify_worker, &job);
+    double elapsed = now_seconds() - start;
+
+    int passed = 0;
+    for (int i = 0; i < count; i++) {
+        passed += pass[i];
+    }
+
+    printf("verified %d shares (%d passed) on %d threads in %.3f s, %.0f verifications/s\n",
+           count, passed, threads, elapsed, elapsed > 0 ? count / elapsed : 0);
+    return passed;
+}
+
+
+// Run the whole algorithm
+// gen cache -> gen dataset -> mine on dataset
+void test_whole_algortihm() {
+    int header_size = 508 + 8 * 5;
+
+    struct Block block = { options.block };
+
+    // create byte array with header_size
+    char* header = malloc(header_size);
+    for (int i = 0; i < header_size; i++) {
         header[i] = '\0';
     }
 
-    int cache_size = CACHE_SIZE;
-    int full_size = DATASET_SIZE;
-    int loop_times = full_size / HASH_BYTES;
+    uint64_t difficulty = options.difficulty;
 
-    char* seedhash = get_seedhash(block);
-    printf("Target: make dataset and save it to a file.\n");
+    struct Epoch epoch;
+    get_epoch(&epoch, block);
+    uint64_t cache_size = epoch.cache_size;
+    uint64_t full_size = epoch.full_size;
+    unsigned char* seedhash = epoch.seedhash;
+    printf("Target: make dataset and mine it.\n");
     printf("Step (1/3): Make cache (around 16MB)... \n");
-    unsigned int** cache = mkcache(cache_size, seedhash);
+    unsigned int* cache = load_cache(options.cache_dir, cache_size, seedhash);
+    printf("cache backed by %s\n", nodes_page_mode(cache, cache_size / HASH_BYTES));
     printf("Step (1/3) finished.\n");
     printf("Step (2/3): Make dataset (around 1GB)... May takes several hours to do so\n");
-    unsigned int** dataset = calc_dataset(full_size, cache, cache_size);
+    unsigned int* dataset = calc_dataset(full_size, cache, cache_size, options.gen_threads);
+    printf("dataset backed by %s\n", nodes_page_mode(dataset, full_size / HASH_BYTES));
     printf("Step (2/3) finished.\n");
-    printf("Step (3/3) save dataset to file.\n");
-    FILE* fp;
-    
-    /* Open file for writing */
-    if ((fp = fopen("dataset", "w")) == NULL) {
-        printf("Cannot open file.\n");
-        return;
-    }
+    printf("Step (3/3) mine a block...\n");
+    struct NumaDataset numa;
+    numa_place_dataset(&numa, dataset, full_size, numa_mode_setting());
+    uint64_t nonce = mine_numa(full_size, &numa, header, header_size, difficulty, options.share_difficulty, options.mine_threads);
+    numa_release_dataset(&numa, full_size);
+    free_nodes(dataset, full_size / HASH_BYTES);
+    free_nodes(cache, cache_size / HASH_BYTES);
+    printf("Step (3/3) finished.\n");
+    printf("\nProgram ends.\n");
+}
 
-    /* write int array to the file*/
-    for (int i = 0; i < loop_times; i++) {
-        if (fwrite(dataset[i], sizeof(int), 16, fp) != 16) {
-            printf("File read error.");
-            return;
-        }
+
+// gen: generate and save dataset to the --dag file for future use
+// the file is written as it is made, an interrupted run resumes
+void save_dataset() {
+    int header_size = 508 + 8 * 5;
+
+    struct Block block = { options.block };
+
+    // create byte array with header_size
+    char* header = malloc(header_size);
+    for (int i = 0; i < header_size; i++) {
+        header[i] = '\0';
     }
 
-    fclose(fp);
+    struct Epoch epoch;
+    get_epoch(&epoch, block);
+    uint64_t cache_size = epoch.cache_size;
 
-    printf("Step (3/3) finished.\n");
+    unsigned char* seedhash = epoch.seedhash;
+    printf("Target: make dataset and save it to a file.\n");
+    printf("Step (1/2): Make cache (around 16MB)... \n");
+    unsigned int* cache = load_cache(options.cache_dir, cache_size, seedhash);
+    printf("Step (1/2) finished.\n");
+    printf("Step (2/2): Make dataset (around 1GB) into the file... May takes several hours to do so\n");
+    printf("If interrupted, run again to resume.\n");
+    int ok = generate_dataset_file(options.dag_path, &epoch, cache, options.gen_threads);
+    free_nodes(cache, cache_size / HASH_BYTES);
+    if (!ok) {
+        return;
+    }
+
+    printf("Step (2/2) finished.\n");
     printf("\nProgram ends.\n");
 }
 
 
-// read file "dataset" as
-// size of dataset should match parameter in this program, error otherwise.
+// mine --backend mmap: mine on the --dag file written by save_dataset()
+// the file header must match the epoch of the block, error otherwise.
 void test_with_dataset() {
     int header_size = 508 + 8 * 5;
 
@@ -609,30 +2741,743 @@ void test_with_dataset() {
         header[i] = '\0';
     }
 
-    char* hashed_header = serialize_hash(sha3(1, header, 0, header_size), 8);
+    char hashed_header[32];
+    keccak_256(hashed_header, header, header_size);
 
-    // difficulty in genesis block
-    // Credit: https://lightrains.com/blogs/setup-local-ethereum-blockchain-private-testnet
-    int difficulty = 0x4000;
+    uint64_t difficulty = options.difficulty;
 
-    int cache_size = CACHE_SIZE;
-    int full_size = DATASET_SIZE;
+    struct Block block = { options.block };
+    struct Epoch epoch;
+    get_epoch(&epoch, block);
+    uint64_t full_size = epoch.full_size;
     printf("Target: use existing dataset and mine it.\n");
+    const unsigned int* dataset = map_dataset(options.dag_path, &epoch, NULL, options.mlock);
+    if (!dataset) {
+        return;
+    }
     printf("Start mining...\n");
-    uint64_t nonce = mine(full_size, NULL, header, 32, difficulty);
+    struct NumaDataset numa;
+    numa_place_dataset(&numa, dataset, full_size, numa_mode_setting());
+    uint64_t nonce = mine_numa(full_size, &numa, hashed_header, 32, difficulty, options.share_difficulty, options.mine_threads);
+    numa_release_dataset(&numa, full_size);
+    unmap_dataset(dataset, full_size);
     printf("Finished.\n");
     printf("\nProgram ends.\n");
 }
 
-int main() {
-#ifdef GEN_DATASET
-    save_dataset();
-    return 0;
-#endif
-#ifdef USE_DATASET
-    test_with_dataset();
-    return 0;
-#endif
-    test_whole_algortihm();
+// light client: evaluate hashes with only the cache in memory
+// (around 16MB instead of the 1GB dataset), as a verifier would do
+// the second block is in the same epoch and reuses the resident cache
+void test_light_client() {
+    int header_size = 32;
+
+    struct Block blocks[2] = { { options.block }, { options.block + 1 } };
+
+    // create byte array with header_size
+    char header[32];
+    for (int i = 0; i < header_size; i++) {
+        header[i] = '\0';
+    }
+
+    struct CacheManager manager;
+    cache_manager_init(&manager);
+
+    // same first nonce as mine()
+    init_genrand64(0);
+    uint64_t nonce = genrand64_int64();
+
+    printf("Target: evaluate a hash with the cache only.\n");
+    for (int b = 0; b < 2; b++) {
+        printf("Step (%d/2): block %" PRIu64 "...\n", b + 1, blocks[b].number);
+        double start = now_seconds();
+        const struct LightCache* c = acquire_light_cache(&manager, blocks[b]);
+        printf("cache of epoch %" PRIu64 " ready in %.3f s\n", c->epoch, now_seconds() - start);
+
+        struct HashResult hash;
+        hashimoto_light(&hash, c->params.full_size, c->cache, c->params.cache_size,
+                        header, header_size, nonce);
+        release_light_cache(&manager, c);
+
+        printf("nonce = %" PRIx64 "\nmix digest = ", nonce);
+        for (int i = 0; i < 32; i++) {
+            printf("%02x", hash.mix_digest[i]);
+        }
+        printf("\nresult = ");
+        for (int i = 0; i < 32; i++) {
+            printf("%02x", hash.result[i]);
+        }
+        printf("\n");
+        printf("Step (%d/2) finished.\n", b + 1);
+    }
+
+    cache_manager_destroy(&manager);
+    printf("\nProgram ends.\n");
+}
+
+// mine --backend light: mine with every dataset page computed from the cache
+// far slower than the other backends, but needs no dataset at all
+void test_light_mining() {
+    char header[32];
+    memset(header, 0, sizeof(header));
+
+    struct Block block = { options.block };
+    struct Epoch epoch;
+    get_epoch(&epoch, block);
+    printf("Target: mine with the cache only.\n");
+    printf("Step (1/2): Make cache (around 16MB)... \n");
+    unsigned int* cache = load_cache(options.cache_dir, epoch.cache_size, epoch.seedhash);
+    printf("Step (1/2) finished.\n");
+    printf("Step (2/2) mine a block...\n");
+    mine_light(epoch.full_size, cache, epoch.cache_size, header, sizeof(header),
+               options.difficulty, options.share_difficulty, options.mine_threads);
+    free_nodes(cache, epoch.cache_size / HASH_BYTES);
+    printf("Step (2/2) finished.\n");
+    printf("\nProgram ends.\n");
+}
+
+// verify: check a burst of VERIFY_SHARES shares, from the cache only
+// (--backend light, the default) or with a dataset in memory or mapped
+// every 10th share carries a wrong mix digest and must be rejected
+void test_verify_batch() {
+    int count = VERIFY_SHARES;
+
+    struct Block block = { options.block };
+
+    struct Epoch epoch;
+    get_epoch(&epoch, block);
+    uint64_t cache_size = epoch.cache_size;
+    uint64_t full_size = epoch.full_size;
+    unsigned char* seedhash = epoch.seedhash;
+    printf("Target: verify a batch of shares (%s backend).\n", backend_names[options.backend]);
+    printf("Step (1/3): Make cache (around 16MB)... \n");
+    unsigned int* cache = load_cache(options.cache_dir, cache_size, seedhash);
+    unsigned int* dataset = NULL;
+    const unsigned int* mapped = NULL;
+    if (options.backend == BACKEND_MEMORY) {
+        dataset = calc_dataset(full_size, cache, cache_size, options.gen_threads);
+    }
+    else if (options.backend == BACKEND_MMAP) {
+        // the cache is at hand, so a file made from another one is refused
+        unsigned char cache_hash[32];
+        keccak_256(cache_hash, cache, cache_size);
+        if (!(mapped = map_dataset(options.dag_path, &epoch, cache_hash, options.mlock))) {
+            free_nodes(cache, cache_size / HASH_BYTES);
+            return;
+        }
+    }
+    printf("Step (1/3) finished.\n");
+    printf("Step (2/3): Make %d shares...\n", count);
+
+    struct VerifyItem* items = calloc(count, sizeof(struct VerifyItem));
+    char* pass = malloc(count);
+    init_genrand64(0);
+    for (int i = 0; i < count; i++) {
+        struct HashResult hash;
+        items[i].header[0] = (char)i;
+        items[i].nonce = genrand64_int64();
+        hashimoto_light(&hash, full_size, cache, cache_size, items[i].header, 32, items[i].nonce);
+        memcpy(items[i].mix_digest, hash.mix_digest, 32);
+        if (i % 10 == 0) {
+            items[i].mix_digest[0] ^= 1;
+        }
+    }
+    printf("Step (2/3) finished.\n");
+    printf("Step (3/3): Verify them...\n");
+    verify_batch(full_size, dataset ? dataset : mapped, cache, cache_size, items, pass, count,
+                 options.mine_threads);
+    printf("Step (3/3) finished.\n");
+
+    free(pass);
+    free(items);
+    if (mapped) {
+        unmap_dataset(mapped, full_size);
+    }
+    free_nodes(dataset, full_size / HASH_BYTES);
+    free_nodes(cache, cache_size / HASH_BYTES);
+    printf("\nProgram ends.\n");
+}
+
+// the chain side of test_pregen_dataset(): reach the next epoch and switch
+struct ChainTip {
+    struct DagBuffers* dag;
+    struct Block block;
+    int switched;
+};
+
+void* advance_chain(void* arg) {
+    struct ChainTip* tip = arg;
+    dag_advance(tip->dag, tip->block);
+    __atomic_store_n(&tip->switched, 1, __ATOMIC_RELEASE);
+    return NULL;
+}
+
+// mine on the current epoch while the next epoch's dataset is built in
+// the background, then cross the epoch boundary without stopping the miners
+void test_pregen_dataset() {
+    int header_size = 32;
+    char header[32];
+    for (int i = 0; i < header_size; i++) {
+        header[i] = '\0';
+    }
+
+    uint64_t difficulty = options.difficulty;
+
+    struct Block block = { options.block };
+    struct DagBuffers dag;
+    printf("Target: mine across an epoch boundary.\n");
+    printf("Step (1/3): Make dataset of epoch %" PRIu64 "...\n", block.number / EPOCH_LENGTH);
+    dag_buffers_init(&dag, block);
+    printf("Step (1/3) finished.\n");
+
+    printf("Step (2/3): mine while the next dataset is made in the background...\n");
+    dag_pregenerate(&dag);
+    struct ChainTip tip = { &dag, { (block.number / EPOCH_LENGTH + 1) * EPOCH_LENGTH }, 0 };
+    pthread_t chain;
+    pthread_create(&chain, NULL, advance_chain, &tip);
+    // one run until the switch, the miners keep going past any block they
+    // solve meanwhile, so no core idles while the next dataset is made
+    uint64_t base = 0;
+    mine_live(&dag, header, header_size, difficulty, options.share_difficulty, options.mine_threads,
+              &tip.switched, &base);
+    pthread_join(chain, NULL);
+    printf("Step (2/3) finished.\n");
+
+    printf("Step (3/3): mine on epoch %" PRIu64 "...\n", dag.active->epoch);
+    mine_live(&dag, header, header_size, difficulty, options.share_difficulty, options.mine_threads,
+              NULL, &base);
+    printf("Step (3/3) finished.\n");
+
+    dag_buffers_destroy(&dag);
+    printf("\nProgram ends.\n");
+}
+
+// one microbenchmark: run(arg, first, count) performs operations
+// first .. first + count - 1 on fixed inputs, so runs are repeatable
+struct Bench {
+    const char* name;
+    const char* op;       // what one operation is
+    double bytes;         // bytes hashed or read by one operation, for GB/s
+    void (*run)(void* arg, uint64_t first, uint64_t count);
+    void* arg;
+    double ns_per_op;     // median over BENCH_RUNS runs, set by run_bench()
+};
+
+// inputs shared by all benchmarks
+struct BenchData {
+    uint64_t state[25];
+    unsigned char msg[HASH_BATCH][HASH_BYTES];
+    unsigned char digest[HASH_BATCH][HASH_BYTES];
+    unsigned int pages[64 * MIX_WORDS];  // L1 resident, fnv mixing alone
+    unsigned int item[HASH_BATCH * NODE_WORDS];
+    struct HashResult hash[HASH_BATCH];
+    const unsigned int* cache;
+    uint64_t cache_size;
+    const unsigned int* dataset;  // in memory or mapped, for the current backend
+    uint64_t full_size;
+    const unsigned char* seedhash;
+    char header[32];
+    unsigned int sink;    // results are folded in here, so nothing is optimized away
+};
+
+void bench_keccakf(void* arg, uint64_t first, uint64_t count) {
+    struct BenchData* d = arg;
+    for (uint64_t i = 0; i < count; i++) {
+        keccak_f1600(d->state);
+    }
+}
+
+void bench_keccak_256(void* arg, uint64_t first, uint64_t count) {
+    struct BenchData* d = arg;
+    for (uint64_t i = 0; i < count; i++) {
+        d->msg[0][0] = (unsigned char)(first + i);
+        keccak_256(d->digest[0], d->msg[0], HASH_BYTES);
+        d->sink ^= d->digest[0][0];
+    }
+}
+
+void bench_keccak_512(void* arg, uint64_t first, uint64_t count) {
+    struct BenchData* d = arg;
+    for (uint64_t i = 0; i < count; i++) {
+        d->msg[0][0] = (unsigned char)(first + i);
+        keccak_512(d->digest[0], d->msg[0], HASH_BYTES);
+        d->sink ^= d->digest[0][0];
+    }
+}
+
+// one operation is one message of a HASH_BATCH batch
+void bench_keccak_512_batch(void* arg, uint64_t first, uint64_t count) {
+    struct BenchData* d = arg;
+    for (uint64_t i = 0; i < count; i += HASH_BATCH) {
+        int n = count - i < HASH_BATCH ? (int)(count - i) : HASH_BATCH;
+        d->msg[0][0] = (unsigned char)(first + i);
+        keccak_512_batch(d->digest, d->msg, HASH_BYTES, n);
+        d->sink ^= d->digest[0][0];
+    }
+}
+
+void bench_fnv_mix(void* arg, uint64_t first, uint64_t count) {
+    struct BenchData* d = arg;
+    mix_vec mix[MIX_VECS] = { { 0 } };
+    for (uint64_t i = 0; i < count; i++) {
+        mix_page(mix, d->pages + (first + i) % 64 * MIX_WORDS);
+    }
+    d->sink ^= mix[0][0];
+}
+
+void bench_calc_dataset_item(void* arg, uint64_t first, uint64_t count) {
+    struct BenchData* d = arg;
+    for (uint64_t i = 0; i < count; i++) {
+        calc_dataset_item(d->item, d->cache, d->cache_size / HASH_BYTES, (int)(first + i));
+        d->sink ^= d->item[0];
+    }
+}
+
+// one operation is one item of a HASH_BATCH batch
+void bench_calc_dataset_items(void* arg, uint64_t first, uint64_t count) {
+    struct BenchData* d = arg;
+    for (uint64_t i = 0; i < count; i += HASH_BATCH) {
+        int n = count - i < HASH_BATCH ? (int)(count - i) : HASH_BATCH;
+        calc_dataset_items(d->item, d->cache, d->cache_size / HASH_BYTES, (int)(first + i), n);
+        d->sink ^= d->item[0];
+    }
+}
+
+void bench_mkcache(void* arg, uint64_t first, uint64_t count) {
+    struct BenchData* d = arg;
+    for (uint64_t i = 0; i < count; i++) {
+        unsigned int* cache = mkcache(d->cache_size, d->seedhash);
+        d->sink ^= cache[0];
+        free_nodes(cache, d->cache_size / HASH_BYTES);
+    }
+}
+
+void bench_hashimoto_full(void* arg, uint64_t first, uint64_t count) {
+    struct BenchData* d = arg;
+    for (uint64_t i = 0; i < count; i++) {
+        hashimoto_full(d->hash, d->full_size, d->dataset, d->header, 32, first + i);
+        d->sink ^= d->hash[0].result[0];
+    }
+}
+
+// one operation is one nonce of a HASH_BATCH batch, as mine() hashes them
+void bench_hashimoto_full_batch(void* arg, uint64_t first, uint64_t count) {
+    struct BenchData* d = arg;
+    for (uint64_t i = 0; i < count; i += HASH_BATCH) {
+        int n = count - i < HASH_BATCH ? (int)(count - i) : HASH_BATCH;
+        hashimoto_full_batch(d->hash, d->full_size, d->dataset, d->header, 32, first + i, n);
+        d->sink ^= d->hash[0].result[0];
+    }
+}
+
+void bench_hashimoto_light(void* arg, uint64_t first, uint64_t count) {
+    struct BenchData* d = arg;
+    for (uint64_t i = 0; i < count; i++) {
+        hashimoto_light(d->hash, d->full_size, d->cache, d->cache_size, d->header, 32, first + i);
+        d->sink ^= d->hash[0].result[0];
+    }
+}
+
+int compare_double(const void* a, const void* b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+// measure b on the calling thread
+// warm up first: operations are run in chunks, doubled until one takes at
+// least 1ms, then one more chunk; each measured run repeats that chunk for
+// at least BENCH_SECONDS
+void run_bench(struct Bench* b) {
+    uint64_t op = 0;
+    uint64_t chunk = 1;
+    for (;;) {
+        double begin = now_seconds();
+        b->run(b->arg, op, chunk);
+        op += chunk;
+        if (now_seconds() - begin >= 1e-3) {
+            break;
+        }
+        chunk *= 2;
+    }
+    b->run(b->arg, op, chunk);
+    op += chunk;
+
+    double ns[BENCH_RUNS];
+    for (int r = 0; r < BENCH_RUNS; r++) {
+        uint64_t done = 0;
+        double begin = now_seconds();
+        double elapsed;
+        do {
+            b->run(b->arg, op, chunk);
+            op += chunk;
+            done += chunk;
+            elapsed = now_seconds() - begin;
+        } while (elapsed < BENCH_SECONDS);
+        ns[r] = elapsed * 1e9 / done;
+    }
+    qsort(ns, BENCH_RUNS, sizeof(double), compare_double);
+    b->ns_per_op = ns[BENCH_RUNS / 2];
+
+    printf("%-30s %-6s %16.1f %14.1f %10.3f\n", b->name, b->op, b->ns_per_op,
+           1e9 / b->ns_per_op, b->bytes / b->ns_per_op);
+    fflush(stdout);
+}
+
+// write the results of count benchmarks to path as JSON
+void write_bench_json(const char* path, const struct Epoch* epoch, const struct Bench* benches, int count) {
+    FILE* f = fopen(path, "w");
+    if (!f) {
+        printf("Cannot open file %s.\n", path);
+        return;
+    }
+    fprintf(f, "{\n  \"epoch\": %" PRIu64 ",\n  \"cache_size\": %" PRIu64 ",\n  \"full_size\": %" PRIu64 ",\n",
+            epoch->epoch, epoch->cache_size, epoch->full_size);
+    fprintf(f, "  \"hash_batch\": %d,\n  \"keccak_kernel\": \"%s\",\n  \"keccak_lanes\": %u,\n",
+            HASH_BATCH, keccak_batch_name(), keccak_batch_lanes());
+    fprintf(f, "  \"mix_kernel\": \"%s\",\n  \"runs\": %d,\n  \"results\": [\n", kernels->name, BENCH_RUNS);
+    for (int i = 0; i < count; i++) {
+        const struct Bench* b = &benches[i];
+        fprintf(f, "    {\"name\": \"%s\", \"op\": \"%s\", \"ns_per_op\": %.3f, \"ops_per_sec\": %.3f, "
+                "\"gb_per_sec\": %.6f}%s\n", b->name, b->op, b->ns_per_op, 1e9 / b->ns_per_op,
+                b->bytes / b->ns_per_op, i + 1 < count ? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+    fclose(f);
+}
+
+// microbenchmarks of every hot kernel, single threaded, at the sizes of
+// the epoch of --block
+// hashimoto_full runs on a dataset in memory and on the same dataset in a
+// file mapped by map_dataset(); the dataset is filled with random words
+// instead of being generated, its content does not change the timing
+// results are printed and written to bench.json
+void run_benchmarks() {
+    struct Block block = { options.block };
+    struct Epoch epoch;
+    get_epoch(&epoch, block);
+
+    struct BenchData* d = calloc(1, sizeof(struct BenchData));
+    d->cache_size = epoch.cache_size;
+    d->full_size = epoch.full_size;
+    d->seedhash = epoch.seedhash;
+    init_genrand64(0);
+    for (int i = 0; i < 64 * MIX_WORDS; i++) {
+        d->pages[i] = (unsigned int)genrand64_int64();
+    }
+
+    printf("Target: benchmark the kernels on epoch %" PRIu64 " sizes.\n", epoch.epoch);
+    printf("Keccak kernel: %s (%u lanes), mix kernel: %s\n", keccak_batch_name(), keccak_batch_lanes(),
+           kernels->name);
+    printf("Making cache and a random dataset...\n");
+    unsigned int* cache = mkcache(epoch.cache_size, epoch.seedhash);
+    d->cache = cache;
+    unsigned int* dataset = alloc_nodes(epoch.full_size / HASH_BYTES);
+    for (uint64_t i = 0; i < epoch.full_size / 8; i++) {
+        ((uint64_t*)dataset)[i] = genrand64_int64();
+    }
+
+    // the file backend reads back the same words through a mapping
+    const char* path = "bench.dataset";
+    struct DagFileHeader h;
+    make_dag_header(&h, &epoch, cache);
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    int written = fd >= 0 && pwrite(fd, &h, sizeof(h), 0) == sizeof(h) &&
+                  pwrite(fd, dataset, epoch.full_size, DAG_PAYLOAD_OFFSET) == (ssize_t)epoch.full_size;
+    if (fd >= 0) {
+        close(fd);
+    }
+    const unsigned int* mapped = written ? map_dataset(path, &epoch, h.cache_hash, 0) : NULL;
+    if (!mapped) {
+        printf("Cannot write %s, the file backend is skipped.\n", path);
+    }
+
+    struct Bench benches[] = {
+        { "keccakf", "perm", 200, bench_keccakf },
+        { "keccak_256 (64B)", "hash", HASH_BYTES, bench_keccak_256 },
+        { "keccak_512 (64B)", "hash", HASH_BYTES, bench_keccak_512 },
+        { "keccak_512_batch (64B)", "hash", HASH_BYTES, bench_keccak_512_batch },
+        { "fnv mix (128B page)", "page", MIX_BYTES, bench_fnv_mix },
+        { "calc_dataset_item", "item", DATASET_PARENTS * HASH_BYTES, bench_calc_dataset_item },
+        { "calc_dataset_items", "item", DATASET_PARENTS * HASH_BYTES, bench_calc_dataset_items },
+        { "mkcache", "cache", (double)epoch.cache_size * (CACHE_ROUNDS + 1), bench_mkcache },
+        { "hashimoto_full (memory)", "hash", ACCESSES * MIX_BYTES, bench_hashimoto_full },
+        { "hashimoto_full_batch (memory)", "hash", ACCESSES * MIX_BYTES, bench_hashimoto_full_batch },
+        { "hashimoto_full (file)", "hash", ACCESSES * MIX_BYTES, bench_hashimoto_full },
+        { "hashimoto_full_batch (file)", "hash", ACCESSES * MIX_BYTES, bench_hashimoto_full_batch },
+        { "hashimoto_light", "hash", ACCESSES * (MIX_BYTES / HASH_BYTES) * DATASET_PARENTS * HASH_BYTES,
+          bench_hashimoto_light },
+    };
+    int count = sizeof(benches) / sizeof(benches[0]);
+
+    printf("%-30s %-6s %16s %14s %10s\n", "benchmark", "op", "ns/op", "op/s", "GB/s");
+    int done = 0;
+    for (int i = 0; i < count; i++) {
+        const char* name = benches[i].name;
+        int file = strstr(name, "(file)") != NULL;
+        if (file && !mapped) {
+            continue;
+        }
+        d->dataset = file ? mapped : dataset;
+        benches[i].arg = d;
+        run_bench(&benches[i]);
+        benches[done++] = benches[i];
+    }
+
+    write_bench_json("bench.json", &epoch, benches, done);
+    printf("Results written to bench.json.\n");
+
+    if (mapped) {
+        unmap_dataset(mapped, epoch.full_size);
+    }
+    unlink(path);
+    free_nodes(dataset, epoch.full_size / HASH_BYTES);
+    free_nodes(cache, epoch.cache_size / HASH_BYTES);
+    free(d);
+    printf("\nProgram ends.\n");
+}
+
+
+// mine: pick the demo of the chosen backend, memory by default
+void mine_command() {
+    switch (options.backend) {
+    case BACKEND_MMAP:
+        test_with_dataset();
+        break;
+    case BACKEND_LIGHT:
+        test_light_mining();
+        break;
+    default:
+        test_whole_algortihm();
+        break;
+    }
+}
+
+// subcommands, the first one is run when none is given
+struct Command {
+    const char* name;
+    void (*run)();
+    const char* help;
+};
+
+const struct Command commands[] = {
+    { "mine", mine_command, "make cache and dataset (or map --dag) and mine a block" },
+    { "gen", save_dataset, "generate the dataset and save it to --dag, resumable" },
+    { "verify", test_verify_batch, "verify a batch of shares on all cores" },
+    { "bench", run_benchmarks, "time every hot kernel, results also go to bench.json" },
+    { "light", test_light_client, "evaluate hashes from a cache only, no dataset needed" },
+    { "pregen", test_pregen_dataset, "mine across an epoch boundary while the next dataset is built" },
+};
+
+#define COMMANDS (int)(sizeof(commands) / sizeof(commands[0]))
+
+void usage(const char* prog) {
+    printf("usage: %s [command] [options]\n\ncommands:\n", prog);
+    for (int i = 0; i < COMMANDS; i++) {
+        printf("  %-8s %s\n", commands[i].name, commands[i].help);
+    }
+    printf("\noptions:\n"
+           "  --block N             block to work on (default %d)\n"
+           "  --epoch N             first block of epoch N\n"
+           "  --threads N           generation and mining threads, 0 is one per core (default 0)\n"
+           "  --pregen-threads N    threads of pregen building the next dataset, 0 is one per core (default %d)\n"
+           "  --dag PATH            dataset file of gen and the mmap backend (default %s)\n"
+           "  --cache-dir DIR       save light caches to DIR and map them back (default %s)\n"
+           "  --no-cache-dir        always make the cache, save nothing\n"
+           "  --backend NAME        memory, mmap or light (mine: memory, verify: light)\n"
+           "  --huge-pages, --no-huge-pages\n"
+           "                        back cache and dataset with huge pages (default %s)\n"
+           "  --mlock               pin a mapped dataset in memory\n"
+           "  --numa MODE           none, interleave or replicate (default %s)\n"
+           "  --nonces N            nonce budget of one mining run (default %d)\n"
+           "  --difficulty N        block difficulty (default %d)\n"
+           "  --share-difficulty N  count hashes meeting this pool difficulty, 0 is off (default %d)\n"
+           "  --cache-size SIZE     override the cache size of the epoch, K/M/G suffix allowed\n"
+           "  --dag-size SIZE       override the dataset size of the epoch, K/M/G suffix allowed\n"
+           "  --metrics PATH        export metrics to PATH.prom and PATH.json (default none)\n"
+           "  --metrics-interval S  seconds between two exports, 0 disables them (default %d)\n"
+           "  -h, --help            show this help\n",
+           BLOCK_NUMBER, PREGEN_THREADS, DAG_PATH, CACHE_DIR, HUGE_PAGES ? "on" : "off", NUMA_MODE, TIME_LIMIT, DIFFICULTY,
+           SHARE_DIFFICULTY, METRICS_INTERVAL);
+}
+
+// parse a non-negative number, 0x prefix and K/M/G suffix allowed when size
+// output: 1 on success, 0 if text is not such a number
+int parse_number(const char* text, uint64_t* out, int size) {
+    char* end;
+    if (*text == '-') {
+        return 0;
+    }
+    uint64_t n = strtoull(text, &end, 0);
+    if (end == text) {
+        return 0;
+    }
+    if (size && *end) {
+        int shift = *end == 'K' || *end == 'k' ? 10 : *end == 'M' || *end == 'm' ? 20 :
+                    *end == 'G' || *end == 'g' ? 30 : -1;
+        if (shift < 0) {
+            return 0;
+        }
+        n <<= shift;
+        end++;
+    }
+    *out = n;
+    return *end == '\0';
+}
+
+// long options without a short form, in the order of long_options below
+enum {
+    OPT_BLOCK = 256, OPT_EPOCH, OPT_THREADS, OPT_PREGEN_THREADS, OPT_DAG, OPT_CACHE_DIR, OPT_NO_CACHE_DIR, OPT_BACKEND, OPT_HUGE_PAGES, OPT_NO_HUGE_PAGES,
+    OPT_MLOCK, OPT_NUMA, OPT_NONCES, OPT_DIFFICULTY, OPT_SHARE_DIFFICULTY, OPT_CACHE_SIZE, OPT_DAG_SIZE,
+    OPT_METRICS, OPT_METRICS_INTERVAL
+};
+
+// fill options from the command line
+// output: the command to run, NULL after an error or --help
+const struct Command* parse_args(int argc, char** argv) {
+    static const struct option long_options[] = {
+        { "block", required_argument, NULL, OPT_BLOCK },
+        { "epoch", required_argument, NULL, OPT_EPOCH },
+        { "threads", required_argument, NULL, OPT_THREADS },
+        { "pregen-threads", required_argument, NULL, OPT_PREGEN_THREADS },
+        { "dag", required_argument, NULL, OPT_DAG },
+        { "cache-dir", required_argument, NULL, OPT_CACHE_DIR },
+        { "no-cache-dir", no_argument, NULL, OPT_NO_CACHE_DIR },
+        { "backend", required_argument, NULL, OPT_BACKEND },
+        { "huge-pages", no_argument, NULL, OPT_HUGE_PAGES },
+        { "no-huge-pages", no_argument, NULL, OPT_NO_HUGE_PAGES },
+        { "mlock", no_argument, NULL, OPT_MLOCK },
+        { "numa", required_argument, NULL, OPT_NUMA },
+        { "nonces", required_argument, NULL, OPT_NONCES },
+        { "difficulty", required_argument, NULL, OPT_DIFFICULTY },
+        { "share-difficulty", required_argument, NULL, OPT_SHARE_DIFFICULTY },
+        { "cache-size", required_argument, NULL, OPT_CACHE_SIZE },
+        { "dag-size", required_argument, NULL, OPT_DAG_SIZE },
+        { "metrics", required_argument, NULL, OPT_METRICS },
+        { "metrics-interval", required_argument, NULL, OPT_METRICS_INTERVAL },
+        { "help", no_argument, NULL, 'h' },
+        { NULL, 0, NULL, 0 }
+    };
+
+    const struct Command* command = &commands[0];
+    if (argc > 1 && argv[1][0] != '-') {
+        command = NULL;
+        for (int i = 0; i < COMMANDS && !command; i++) {
+            if (strcmp(argv[1], commands[i].name) == 0) {
+                command = &commands[i];
+            }
+        }
+        if (!command) {
+            printf("Unknown command %s, see %s --help.\n", argv[1], argv[0]);
+            return NULL;
+        }
+        argv[1] = argv[0];
+        argc--;
+        argv++;
+    }
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "h", long_options, NULL)) != -1) {
+        uint64_t n = 0;
+        int ok = 1;
+        switch (opt) {
+        case OPT_BLOCK:
+            ok = parse_number(optarg, &options.block, 0);
+            break;
+        case OPT_EPOCH:
+            ok = parse_number(optarg, &n, 0) && n <= UINT64_MAX / EPOCH_LENGTH;
+            options.block = n * EPOCH_LENGTH;
+            break;
+        case OPT_THREADS:
+            ok = parse_number(optarg, &n, 0) && n <= 4096;
+            options.gen_threads = options.mine_threads = (int)n;
+            break;
+        case OPT_PREGEN_THREADS:
+            ok = parse_number(optarg, &n, 0) && n <= 4096;
+            options.pregen_threads = (int)n;
+            break;
+        case OPT_DAG:
+            options.dag_path = optarg;
+            break;
+        case OPT_CACHE_DIR:
+        case OPT_NO_CACHE_DIR:
+            options.cache_dir = opt == OPT_CACHE_DIR ? optarg : NULL;
+            break;
+        case OPT_BACKEND:
+            ok = 0;
+            for (int b = BACKEND_MEMORY; b <= BACKEND_LIGHT && !ok; b++) {
+                if (strcmp(optarg, backend_names[b]) == 0) {
+                    options.backend = b;
+                    ok = 1;
+                }
+            }
+            break;
+        case OPT_HUGE_PAGES:
+        case OPT_NO_HUGE_PAGES:
+            options.huge_pages = opt == OPT_HUGE_PAGES;
+            break;
+        case OPT_MLOCK:
+            options.mlock = 1;
+            break;
+        case OPT_NUMA:
+            ok = 0;
+            for (int m = NUMA_NONE; m <= NUMA_REPLICATE && !ok; m++) {
+                ok = strcmp(optarg, numa_mode_names[m]) == 0;
+            }
+            options.numa = optarg;
+            break;
+        case OPT_NONCES:
+            ok = parse_number(optarg, &options.nonces, 0);
+            break;
+        case OPT_DIFFICULTY:
+            ok = parse_number(optarg, &options.difficulty, 0);
+            break;
+        case OPT_SHARE_DIFFICULTY:
+            ok = parse_number(optarg, &options.share_difficulty, 0);
+            break;
+        case OPT_CACHE_SIZE:
+            ok = parse_number(optarg, &options.cache_size, 1) && options.cache_size % HASH_BYTES == 0;
+            break;
+        case OPT_DAG_SIZE:
+            ok = parse_number(optarg, &options.dag_size, 1) && options.dag_size % MIX_BYTES == 0;
+            break;
+        case OPT_METRICS:
+            options.metrics_path = optarg;
+            break;
+        case OPT_METRICS_INTERVAL:
+            ok = parse_number(optarg, &n, 0) && n <= METRICS_WINDOW;
+            options.metrics_interval = (int)n;
+            break;
+        case 'h':
+            usage(argv[0]);
+            return NULL;
+        default:
+            printf("See %s --help.\n", argv[0]);
+            return NULL;
+        }
+        if (!ok) {
+            printf("Invalid value %s for --%s.\n", optarg, long_options[opt - OPT_BLOCK].name);
+            return NULL;
+        }
+    }
+    if (optind < argc) {
+        printf("Unexpected argument %s, see %s --help.\n", argv[optind], argv[0]);
+        return NULL;
+    }
+    if (options.dag_size && options.cache_size > options.dag_size) {
+        printf("The cache cannot be larger than the dataset.\n");
+        return NULL;
+    }
+    return command;
+}
+
+
+int main(int argc, char** argv) {
+    const struct Command* command = parse_args(argc, argv);
+    if (!command) {
+        return 1;
+    }
+    metrics_start();
+    command->run();
+    metrics_stop();
     return 0;
-}
\ No newline at end of file
+}
+#endif // LIBCETHASH
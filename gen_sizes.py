@@ -0,0 +1,59 @@
+#!/usr/bin/env python3
+# regenerate sizes.h: cache and dataset sizes of the first EPOCHS epochs,
+# by the prime rule of the spec (get_cache_size() and get_full_size() in
+# ethash.c apply the same rule to later epochs)
+# usage: python3 gen_sizes.py > sizes.h   (or make sizes)
+
+EPOCHS = 2048
+HASH_BYTES = 64
+MIX_BYTES = 128
+CACHE_BYTES_INIT = 2 ** 24
+CACHE_BYTES_GROWTH = 2 ** 17
+DATASET_BYTES_INIT = 2 ** 30
+DATASET_BYTES_GROWTH = 2 ** 23
+
+
+def isprime(x):
+    if x < 2:
+        return False
+    i = 2
+    while i * i <= x:
+        if x % i == 0:
+            return False
+        i += 1
+    return True
+
+
+def size(init, growth, unit, epoch):
+    sz = init + growth * epoch - unit
+    while not isprime(sz // unit):
+        sz -= 2 * unit
+    return sz
+
+
+def table(name, init, growth, unit):
+    lines = ["static const uint64_t %s[SIZE_TABLE_EPOCHS] = {" % name]
+    sizes = [size(init, growth, unit, e) for e in range(EPOCHS)]
+    for i in range(0, EPOCHS, 4):
+        lines.append("    " + " ".join("%dULL," % s for s in sizes[i:i + 4]))
+    lines.append("};")
+    return "\n".join(lines)
+
+
+print("""#ifndef SIZES_H
+#define SIZES_H
+#include <stdint.h>
+
+// Cache and dataset sizes in bytes of the first SIZE_TABLE_EPOCHS epochs,
+// indexed by epoch. Precomputed with the spec's prime rule, see
+// get_cache_size() and get_full_size() in ethash.c, which fall back to
+// that rule for later epochs. Generated by gen_sizes.py, do not edit.
+
+#define SIZE_TABLE_EPOCHS %d
+
+%s
+
+%s
+
+#endif""" % (EPOCHS, table("cache_sizes", CACHE_BYTES_INIT, CACHE_BYTES_GROWTH, HASH_BYTES),
+              table("dataset_sizes", DATASET_BYTES_INIT, DATASET_BYTES_GROWTH, MIX_BYTES)))
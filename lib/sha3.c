@@ -18,6 +18,7 @@
 
 #include <stdio.h>
 #include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "sha3.h"
@@ -326,3 +327,276 @@ sha3_return_t sha3_HashBuffer( unsigned bitSize, enum SHA3_FLAGS flags, const vo
     memcpy(out, h, outBytes);
     return SHA3_RETURN_OK;
 }
+
+/* ************************ Fixed-size Keccak ************************** */
+
+/* endian-independent word access, folds to a plain load/store on
+ * little-endian targets */
+static uint64_t
+keccak_load64(const uint8_t *p)
+{
+    return (uint64_t) (p[0]) |
+            ((uint64_t) (p[1]) << 8 * 1) |
+            ((uint64_t) (p[2]) << 8 * 2) |
+            ((uint64_t) (p[3]) << 8 * 3) |
+            ((uint64_t) (p[4]) << 8 * 4) |
+            ((uint64_t) (p[5]) << 8 * 5) |
+            ((uint64_t) (p[6]) << 8 * 6) |
+            ((uint64_t) (p[7]) << 8 * 7);
+}
+
+static void
+keccak_store64(uint8_t *p, uint64_t v)
+{
+    unsigned i;
+    for(i = 0; i < 8; i++)
+        p[i] = (uint8_t) (v >> (8 * i));
+}
+
+/* absorb whole rate blocks, pad the tail, squeeze outWords words */
+static void
+keccak_fixed(unsigned rateWords, void *out, unsigned outWords,
+        const void *in, size_t len)
+{
+    uint64_t s[SHA3_KECCAK_SPONGE_WORDS];
+    uint8_t last[SHA3_KECCAK_SPONGE_WORDS * 8];
+    const uint8_t *buf = in;
+    const size_t rateBytes = rateWords * 8;
+    unsigned i;
+
+    memset(s, 0, sizeof(s));
+
+    for(; len >= rateBytes; len -= rateBytes, buf += rateBytes) {
+        for(i = 0; i < rateWords; i++)
+            s[i] ^= keccak_load64(buf + i * 8);
+        keccakf(s);
+    }
+
+    /* Keccak padding: 0x01 || 0x00* || 0x80 */
+    memset(last, 0, rateBytes);
+    memcpy(last, buf, len);
+    last[len] ^= 0x01;
+    last[rateBytes - 1] ^= 0x80;
+    for(i = 0; i < rateWords; i++)
+        s[i] ^= keccak_load64(last + i * 8);
+    keccakf(s);
+
+    for(i = 0; i < outWords; i++)
+        keccak_store64((uint8_t *) out + i * 8, s[i]);
+}
+
+void
+keccak_256(void *out, const void *in, size_t len)
+{
+    keccak_fixed(SHA3_KECCAK_SPONGE_WORDS - 2 * 256 / 64, out, 256 / 64, in, len);
+}
+
+void
+keccak_512(void *out, const void *in, size_t len)
+{
+    keccak_fixed(SHA3_KECCAK_SPONGE_WORDS - 2 * 512 / 64, out, 512 / 64, in, len);
+}
+
+/* one 64 byte block fits the 72 byte rate of Keccak-512 with its padding,
+ * so it takes a single permutation and no tail buffer */
+void
+keccak_512_64(void *out, const void *in)
+{
+    uint64_t s[SHA3_KECCAK_SPONGE_WORDS];
+    unsigned i;
+
+    for(i = 0; i < 8; i++)
+        s[i] = keccak_load64((const uint8_t *) in + i * 8);
+    s[8] = 0x01 | (uint64_t) 0x80 << 56;
+    memset(s + 9, 0, sizeof(s) - 9 * sizeof(s[0]));
+    keccakf(s);
+
+    for(i = 0; i < 8; i++)
+        keccak_store64((uint8_t *) out + i * 8, s[i]);
+}
+
+void
+keccak_f1600(uint64_t s[25])
+{
+    keccakf(s);
+}
+
+/* ************************ Multi-buffer Keccak ************************ */
+
+/* The kernels are built three times, for the baseline target (SSE2 on
+ * x86-64), AVX2 and AVX-512, each with as many lanes as its registers
+ * hold. keccak_batch_select() picks one at startup. */
+#define KECCAK_LANES 2
+#define KECCAK_VARIANT generic
+#include "sha3_lanes.h"
+#undef KECCAK_LANES
+#undef KECCAK_VARIANT
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && !defined(__clang__)
+#define KECCAK_X86_VARIANTS
+
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#define KECCAK_LANES 4
+#define KECCAK_VARIANT avx2
+#include "sha3_lanes.h"
+#undef KECCAK_LANES
+#undef KECCAK_VARIANT
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx512f")
+#define KECCAK_LANES 8
+#define KECCAK_VARIANT avx512
+#include "sha3_lanes.h"
+#undef KECCAK_LANES
+#undef KECCAK_VARIANT
+#pragma GCC pop_options
+
+static int
+keccak_has_avx2(void)
+{
+    return __builtin_cpu_supports("avx2");
+}
+
+static int
+keccak_has_avx512(void)
+{
+    return __builtin_cpu_supports("avx512f");
+}
+#endif
+
+static int
+keccak_has_baseline(void)
+{
+    return 1;
+}
+
+typedef void keccak_batch_fn(unsigned rateWords, void *out, unsigned outWords,
+        const void *in, size_t len, size_t n);
+
+static const struct keccak_batch_variant {
+    const char *name;
+    unsigned lanes;
+    int (*supported)(void);
+    keccak_batch_fn *batch;
+} keccak_batch_variants[] = {
+    /* fastest first */
+#ifdef KECCAK_X86_VARIANTS
+    { "avx512", 8, keccak_has_avx512, keccak_fixed_batch_avx512 },
+    { "avx2", 4, keccak_has_avx2, keccak_fixed_batch_avx2 },
+#endif
+    { "generic", 2, keccak_has_baseline, keccak_fixed_batch_generic },
+};
+
+/* the variant in use, set once by keccak_batch_select() before main() */
+static const struct keccak_batch_variant *keccak_batch;
+
+/* Known answers of the scalar Keccak on the empty message */
+static const uint8_t keccak_256_empty[32] = {
+    0xc5, 0xd2, 0x46, 0x01, 0x86, 0xf7, 0x23, 0x3c, 0x92, 0x7e, 0x7d, 0xb2,
+    0xdc, 0xc7, 0x03, 0xc0, 0xe5, 0x00, 0xb6, 0x53, 0xca, 0x82, 0x27, 0x3b,
+    0x7b, 0xfa, 0xd8, 0x04, 0x5d, 0x85, 0xa4, 0x70
+};
+
+static const uint8_t keccak_512_empty[64] = {
+    0x0e, 0xab, 0x42, 0xde, 0x4c, 0x3c, 0xeb, 0x92, 0x35, 0xfc, 0x91, 0xac,
+    0xff, 0xe7, 0x46, 0xb2, 0x9c, 0x29, 0xa8, 0xc3, 0x66, 0xb7, 0xc6, 0x0e,
+    0x4e, 0x67, 0xc4, 0x66, 0xf3, 0x6a, 0x43, 0x04, 0xc0, 0x0f, 0xa9, 0xca,
+    0xf9, 0xd8, 0x79, 0x76, 0xba, 0x46, 0x9b, 0xcb, 0xe0, 0x67, 0x13, 0xb4,
+    0x35, 0xf0, 0x91, 0xef, 0x27, 0x69, 0xfb, 0x16, 0x0c, 0xda, 0xb3, 0x3d,
+    0x36, 0x70, 0x68, 0x0e
+};
+
+/* Known-answer test of a batch kernel: batches of 11 messages (idle lanes
+ * and more than one round of lanes for every variant) at lengths around
+ * both rates must match the scalar Keccak, itself checked against the
+ * empty message answers first. */
+static int
+keccak_batch_selftest(keccak_batch_fn *batch)
+{
+    static const size_t lens[] = { 0, 64, 71, 72, 135, 136, 200 };
+    uint8_t msg[11 * 200];
+    uint8_t got[11 * 64];
+    uint8_t want[64];
+    size_t i, k, n = 11;
+
+    for(i = 0; i < sizeof(msg); i++)
+        msg[i] = (uint8_t) (i * 131 + 7);
+
+    keccak_256(want, msg, 0);
+    if(memcmp(want, keccak_256_empty, 32) != 0)
+        return 0;
+    keccak_512(want, msg, 0);
+    if(memcmp(want, keccak_512_empty, 64) != 0)
+        return 0;
+
+    for(k = 0; k < sizeof(lens) / sizeof(lens[0]); k++) {
+        batch(SHA3_KECCAK_SPONGE_WORDS - 2 * 256 / 64, got, 256 / 64, msg, lens[k], n);
+        for(i = 0; i < n; i++) {
+            keccak_256(want, msg + i * lens[k], lens[k]);
+            if(memcmp(got + i * 32, want, 32) != 0)
+                return 0;
+        }
+        batch(SHA3_KECCAK_SPONGE_WORDS - 2 * 512 / 64, got, 512 / 64, msg, lens[k], n);
+        for(i = 0; i < n; i++) {
+            keccak_512(want, msg + i * lens[k], lens[k]);
+            if(memcmp(got + i * 64, want, 64) != 0)
+                return 0;
+        }
+    }
+    return 1;
+}
+
+/* Pick the fastest batch kernel the cpu supports (cpuid) and that passes
+ * its known-answer test. Runs once at startup, ahead of the constructors
+ * of other files that may hash (priority 101). */
+__attribute__ ((constructor(101))) static void
+keccak_batch_select(void)
+{
+    size_t i, count = sizeof(keccak_batch_variants) / sizeof(keccak_batch_variants[0]);
+
+#ifdef KECCAK_X86_VARIANTS
+    __builtin_cpu_init();
+#endif
+    for(i = 0; i < count; i++) {
+        const struct keccak_batch_variant *v = &keccak_batch_variants[i];
+        if(!v->supported())
+            continue;
+        if(!keccak_batch_selftest(v->batch)) {
+            fprintf(stderr, "sha3: %s Keccak kernel failed its self-check, "
+                    "not used\n", v->name);
+            continue;
+        }
+        keccak_batch = v;
+        return;
+    }
+    fprintf(stderr, "sha3: no Keccak kernel passed its self-check\n");
+    abort();
+}
+
+const char *
+keccak_batch_name(void)
+{
+    return keccak_batch->name;
+}
+
+unsigned
+keccak_batch_lanes(void)
+{
+    return keccak_batch->lanes;
+}
+
+void
+keccak_256_batch(void *out, const void *in, size_t len, size_t n)
+{
+    keccak_batch->batch(SHA3_KECCAK_SPONGE_WORDS - 2 * 256 / 64, out, 256 / 64,
+            in, len, n);
+}
+
+void
+keccak_512_batch(void *out, const void *in, size_t len, size_t n)
+{
+    keccak_batch->batch(SHA3_KECCAK_SPONGE_WORDS - 2 * 512 / 64, out, 512 / 64,
+            in, len, n);
+}
@@ -68,4 +68,32 @@ sha3_return_t sha3_HashBuffer(
     const void *in, unsigned inBytes, 
     void *out, unsigned outBytes );     /* up to bitSize/8; truncation OK */
 
+/* Fixed-size Keccak (original 0x01 padding, as used by Ethash).
+ * Hashes len bytes at in straight into the caller's buffer, which must hold
+ * 32 bytes for keccak_256 and 64 bytes for keccak_512. No allocation and no
+ * context; out may alias in. */
+void keccak_256(void *out, const void *in, size_t len);
+void keccak_512(void *out, const void *in, size_t len);
+/* keccak_512 of exactly 64 bytes, out may alias in. */
+void keccak_512_64(void *out, const void *in);
+
+/* The bare Keccak-f[1600] permutation of a 25 word state, in place.
+ * Exposed for benchmarks. */
+void keccak_f1600(uint64_t s[25]);
+
+/* Multi-buffer Keccak: keccak_batch_lanes() independent states are kept
+ * lane-interleaved in vector registers and permuted in one pass
+ * (8-way with AVX-512, 4-way with AVX2, 2-way with SSE2 or generic).
+ * The kernel is chosen at startup from cpuid, among the variants that
+ * pass a known-answer self-check; keccak_batch_name() tells which. */
+const char *keccak_batch_name(void);
+unsigned keccak_batch_lanes(void);
+
+/* Hash n messages of len bytes each, stored back to back at in, into n
+ * digests of 32/64 bytes stored back to back at out. Any n is accepted;
+ * batches of a multiple of keccak_batch_lanes() keep every lane busy. out may
+ * alias in when len is at least the digest size. */
+void keccak_256_batch(void *out, const void *in, size_t len, size_t n);
+void keccak_512_batch(void *out, const void *in, size_t len, size_t n);
+
 #endif
@@ -0,0 +1,129 @@
+/* Multi-buffer Keccak kernels, included by sha3.c once per instruction
+ * set. The includer defines KECCAK_LANES and KECCAK_VARIANT (a suffix for
+ * every name below) and selects the target with #pragma GCC target. */
+
+#define KECCAK_VARIANT_CAT(a, b) a##_##b
+#define KECCAK_VARIANT_NAME(a, b) KECCAK_VARIANT_CAT(a, b)
+
+#define keccak_lanes_t      KECCAK_VARIANT_NAME(keccak_lanes_t, KECCAK_VARIANT)
+#define keccakf_lanes       KECCAK_VARIANT_NAME(keccakf_lanes, KECCAK_VARIANT)
+#define keccak_absorb_lanes KECCAK_VARIANT_NAME(keccak_absorb_lanes, KECCAK_VARIANT)
+#define keccak_fixed_batch  KECCAK_VARIANT_NAME(keccak_fixed_batch, KECCAK_VARIANT)
+
+/* One vector holds the same state word of KECCAK_LANES independent
+ * states. GCC vector extensions map the operators below to SSE2, AVX2 or
+ * AVX-512 instructions depending on the target of the includer. */
+typedef uint64_t keccak_lanes_t
+        __attribute__ ((vector_size(KECCAK_LANES * sizeof(uint64_t))));
+
+static void
+keccakf_lanes(keccak_lanes_t s[25])
+{
+    int i, j, round;
+    keccak_lanes_t t, bc[5];
+
+    for(round = 0; round < KECCAK_ROUNDS; round++) {
+
+        /* Theta */
+        for(i = 0; i < 5; i++)
+            bc[i] = s[i] ^ s[i + 5] ^ s[i + 10] ^ s[i + 15] ^ s[i + 20];
+
+        for(i = 0; i < 5; i++) {
+            t = bc[(i + 4) % 5] ^ SHA3_ROTL64(bc[(i + 1) % 5], 1);
+            for(j = 0; j < 25; j += 5)
+                s[j + i] ^= t;
+        }
+
+        /* Rho Pi */
+        t = s[1];
+        for(i = 0; i < 24; i++) {
+            j = keccakf_piln[i];
+            bc[0] = s[j];
+            s[j] = SHA3_ROTL64(t, keccakf_rotc[i]);
+            t = bc[0];
+        }
+
+        /* Chi */
+        for(j = 0; j < 25; j += 5) {
+            for(i = 0; i < 5; i++)
+                bc[i] = s[j + i];
+            for(i = 0; i < 5; i++)
+                s[j + i] ^= (~bc[(i + 1) % 5]) & bc[(i + 2) % 5];
+        }
+
+        /* Iota */
+        s[0] ^= keccakf_rndc[round];
+    }
+}
+
+/* XOR word i of every lane's block into the interleaved state */
+static void
+keccak_absorb_lanes(keccak_lanes_t s[25], const uint8_t *blk[KECCAK_LANES],
+        unsigned rateWords)
+{
+    uint64_t w[KECCAK_LANES];
+    keccak_lanes_t v;
+    unsigned i, l;
+
+    for(i = 0; i < rateWords; i++) {
+        for(l = 0; l < KECCAK_LANES; l++)
+            w[l] = keccak_load64(blk[l] + i * 8);
+        memcpy(&v, w, sizeof(v));
+        s[i] ^= v;
+    }
+}
+
+static void
+keccak_fixed_batch(unsigned rateWords, void *out, unsigned outWords,
+        const void *in, size_t len, size_t n)
+{
+    const size_t rateBytes = rateWords * 8;
+    const size_t outBytes = outWords * 8;
+    const uint8_t *msg = in;
+    uint8_t *dst = out;
+    uint8_t last[KECCAK_LANES][SHA3_KECCAK_SPONGE_WORDS * 8];
+    const uint8_t *blk[KECCAK_LANES];
+    keccak_lanes_t s[SHA3_KECCAK_SPONGE_WORDS];
+    uint64_t w[KECCAK_LANES];
+    size_t base, off;
+    unsigned i, l, lanes;
+
+    for(base = 0; base < n; base += lanes) {
+        lanes = n - base < KECCAK_LANES ? (unsigned) (n - base) : KECCAK_LANES;
+
+        memset(s, 0, sizeof(s));
+
+        /* idle lanes of a short batch just repeat the last message */
+        for(off = 0; len - off >= rateBytes; off += rateBytes) {
+            for(l = 0; l < KECCAK_LANES; l++)
+                blk[l] = msg + (base + (l < lanes ? l : lanes - 1)) * len + off;
+            keccak_absorb_lanes(s, blk, rateWords);
+            keccakf_lanes(s);
+        }
+
+        /* Keccak padding: 0x01 || 0x00* || 0x80 */
+        for(l = 0; l < KECCAK_LANES; l++) {
+            memset(last[l], 0, rateBytes);
+            memcpy(last[l], msg + (base + (l < lanes ? l : lanes - 1)) * len + off,
+                    len - off);
+            last[l][len - off] ^= 0x01;
+            last[l][rateBytes - 1] ^= 0x80;
+            blk[l] = last[l];
+        }
+        keccak_absorb_lanes(s, blk, rateWords);
+        keccakf_lanes(s);
+
+        for(i = 0; i < outWords; i++) {
+            memcpy(w, &s[i], sizeof(w));
+            for(l = 0; l < lanes; l++)
+                keccak_store64(dst + (base + l) * outBytes + i * 8, w[l]);
+        }
+    }
+}
+
+#undef keccak_lanes_t
+#undef keccakf_lanes
+#undef keccak_absorb_lanes
+#undef keccak_fixed_batch
+#undef KECCAK_VARIANT_NAME
+#undef KECCAK_VARIANT_CAT
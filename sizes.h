@@ -0,0 +1,1042 @@
+#ifndef SIZES_H
+#define SIZES_H
+#include <stdint.h>
+
+// Cache and dataset sizes in bytes of the first SIZE_TABLE_EPOCHS epochs,
+// indexed by epoch. Precomputed with the spec's prime rule, see
+// get_cache_size() and get_full_size() in ethash.c, which fall back to
+// that rule for later epochs. Generated by gen_sizes.py, do not edit.
+
+#define SIZE_TABLE_EPOCHS 2048
+
+static const uint64_t cache_sizes[SIZE_TABLE_EPOCHS] = {
+    16776896ULL, 16907456ULL, 17039296ULL, 17170112ULL,
+    17301056ULL, 17432512ULL, 17563072ULL, 17693888ULL,
+    17824192ULL, 17955904ULL, 18087488ULL, 18218176ULL,
+    18349504ULL, 18481088ULL, 18611392ULL, 18742336ULL,
+    18874304ULL, 19004224ULL, 19135936ULL, 19267264ULL,
+    19398208ULL, 19529408ULL, 19660096ULL, 19791424ULL,
+    19922752ULL, 20053952ULL, 20184896ULL, 20315968ULL,
+    20446912ULL, 20576576ULL, 20709184ULL, 20840384ULL,
+    20971072ULL, 21102272ULL, 21233216ULL, 21364544ULL,
+    21494848ULL, 21626816ULL, 21757376ULL, 21887552ULL,
+    22019392ULL, 22151104ULL, 22281536ULL, 22412224ULL,
+    22543936ULL, 22675264ULL, 22806464ULL, 22935872ULL,
+    23068096ULL, 23198272ULL, 23330752ULL, 23459008ULL,
+    23592512ULL, 23723968ULL, 23854912ULL, 23986112ULL,
+    24116672ULL, 24247616ULL, 24378688ULL, 24509504ULL,
+    24640832ULL, 24772544ULL, 24903488ULL, 25034432ULL,
+    25165376ULL, 25296704ULL, 25427392ULL, 25558592ULL,
+    25690048ULL, 25820096ULL, 25951936ULL, 26081728ULL,
+    26214208ULL, 26345024ULL, 26476096ULL, 26606656ULL,
+    26737472ULL, 26869184ULL, 26998208ULL, 27131584ULL,
+    27262528ULL, 27393728ULL, 27523904ULL, 27655744ULL,
+    27786688ULL, 27917888ULL, 28049344ULL, 28179904ULL,
+    28311488ULL, 28441792ULL, 28573504ULL, 28700864ULL,
+    28835648ULL, 28966208ULL, 29096768ULL, 29228608ULL,
+    29359808ULL, 29490752ULL, 29621824ULL, 29752256ULL,
+    29882816ULL, 30014912ULL, 30144448ULL, 30273728ULL,
+    30406976ULL, 30538432ULL, 30670784ULL, 30799936ULL,
+    30932672ULL, 31063744ULL, 31195072ULL, 31325248ULL,
+    31456192ULL, 31588288ULL, 31719232ULL, 31850432ULL,
+    31981504ULL, 32110784ULL, 32243392ULL, 32372672ULL,
+    32505664ULL, 32636608ULL, 32767808ULL, 32897344ULL,
+    33029824ULL, 33160768ULL, 33289664ULL, 33423296ULL,
+    33554368ULL, 33683648ULL, 33816512ULL, 33947456ULL,
+    34076992ULL, 34208704ULL, 34340032ULL, 34471744ULL,
+    34600256ULL, 34734016ULL, 34864576ULL, 34993984ULL,
+    35127104ULL, 35258176ULL, 35386688ULL, 35518528ULL,
+    35650624ULL, 35782336ULL, 35910976ULL, 36044608ULL,
+    36175808ULL, 36305728ULL, 36436672ULL, 36568384ULL,
+    36699968ULL, 36830656ULL, 36961984ULL, 37093312ULL,
+    37223488ULL, 37355072ULL, 37486528ULL, 37617472ULL,
+    37747904ULL, 37879232ULL, 38009792ULL, 38141888ULL,
+    38272448ULL, 38403392ULL, 38535104ULL, 38660672ULL,
+    38795584ULL, 38925632ULL, 39059264ULL, 39190336ULL,
+    39320768ULL, 39452096ULL, 39581632ULL, 39713984ULL,
+    39844928ULL, 39974848ULL, 40107968ULL, 40238144ULL,
+    40367168ULL, 40500032ULL, 40631744ULL, 40762816ULL,
+    40894144ULL, 41023552ULL, 41155904ULL, 41286208ULL,
+    41418304ULL, 41547712ULL, 41680448ULL, 41811904ULL,
+    41942848ULL, 42073792ULL, 42204992ULL, 42334912ULL,
+    42467008ULL, 42597824ULL, 42729152ULL, 42860096ULL,
+    42991552ULL, 43122368ULL, 43253696ULL, 43382848ULL,
+    43515712ULL, 43646912ULL, 43777088ULL, 43907648ULL,
+    44039104ULL, 44170432ULL, 44302144ULL, 44433344ULL,
+    44564288ULL, 44694976ULL, 44825152ULL, 44956864ULL,
+    45088448ULL, 45219008ULL, 45350464ULL, 45481024ULL,
+    45612608ULL, 45744064ULL, 45874496ULL, 46006208ULL,
+    46136768ULL, 46267712ULL, 46399424ULL, 46529344ULL,
+    46660672ULL, 46791488ULL, 46923328ULL, 47053504ULL,
+    47185856ULL, 47316928ULL, 47447872ULL, 47579072ULL,
+    47710144ULL, 47839936ULL, 47971648ULL, 48103232ULL,
+    48234176ULL, 48365248ULL, 48496192ULL, 48627136ULL,
+    48757312ULL, 48889664ULL, 49020736ULL, 49149248ULL,
+    49283008ULL, 49413824ULL, 49545152ULL, 49675712ULL,
+    49807168ULL, 49938368ULL, 50069056ULL, 50200256ULL,
+    50331584ULL, 50462656ULL, 50593472ULL, 50724032ULL,
+    50853952ULL, 50986048ULL, 51117632ULL, 51248576ULL,
+    51379904ULL, 51510848ULL, 51641792ULL, 51773248ULL,
+    51903296ULL, 52035136ULL, 52164032ULL, 52297664ULL,
+    52427968ULL, 52557376ULL, 52690112ULL, 52821952ULL,
+    52952896ULL, 53081536ULL, 53213504ULL, 53344576ULL,
+    53475776ULL, 53608384ULL, 53738816ULL, 53870528ULL,
+    54000832ULL, 54131776ULL, 54263744ULL, 54394688ULL,
+    54525248ULL, 54655936ULL, 54787904ULL, 54918592ULL,
+    55049152ULL, 55181248ULL, 55312064ULL, 55442752ULL,
+    55574336ULL, 55705024ULL, 55836224ULL, 55967168ULL,
+    56097856ULL, 56228672ULL, 56358592ULL, 56490176ULL,
+    56621888ULL, 56753728ULL, 56884928ULL, 57015488ULL,
+    57146816ULL, 57278272ULL, 57409216ULL, 57540416ULL,
+    57671104ULL, 57802432ULL, 57933632ULL, 58064576ULL,
+    58195264ULL, 58326976ULL, 58457408ULL, 58588864ULL,
+    58720192ULL, 58849984ULL, 58981696ULL, 59113024ULL,
+    59243456ULL, 59375552ULL, 59506624ULL, 59637568ULL,
+    59768512ULL, 59897792ULL, 60030016ULL, 60161984ULL,
+    60293056ULL, 60423872ULL, 60554432ULL, 60683968ULL,
+    60817216ULL, 60948032ULL, 61079488ULL, 61209664ULL,
+    61341376ULL, 61471936ULL, 61602752ULL, 61733696ULL,
+    61865792ULL, 61996736ULL, 62127808ULL, 62259136ULL,
+    62389568ULL, 62520512ULL, 62651584ULL, 62781632ULL,
+    62910784ULL, 63045056ULL, 63176128ULL, 63307072ULL,
+    63438656ULL, 63569216ULL, 63700928ULL, 63831616ULL,
+    63960896ULL, 64093888ULL, 64225088ULL, 64355392ULL,
+    64486976ULL, 64617664ULL, 64748608ULL, 64879424ULL,
+    65009216ULL, 65142464ULL, 65273792ULL, 65402816ULL,
+    65535424ULL, 65666752ULL, 65797696ULL, 65927744ULL,
+    66060224ULL, 66191296ULL, 66321344ULL, 66453056ULL,
+    66584384ULL, 66715328ULL, 66846656ULL, 66977728ULL,
+    67108672ULL, 67239104ULL, 67370432ULL, 67501888ULL,
+    67631296ULL, 67763776ULL, 67895104ULL, 68026304ULL,
+    68157248ULL, 68287936ULL, 68419264ULL, 68548288ULL,
+    68681408ULL, 68811968ULL, 68942912ULL, 69074624ULL,
+    69205568ULL, 69337024ULL, 69467584ULL, 69599168ULL,
+    69729472ULL, 69861184ULL, 69989824ULL, 70122944ULL,
+    70253888ULL, 70385344ULL, 70515904ULL, 70647232ULL,
+    70778816ULL, 70907968ULL, 71040832ULL, 71171648ULL,
+    71303104ULL, 71432512ULL, 71564992ULL, 71695168ULL,
+    71826368ULL, 71958464ULL, 72089536ULL, 72219712ULL,
+    72350144ULL, 72482624ULL, 72613568ULL, 72744512ULL,
+    72875584ULL, 73006144ULL, 73138112ULL, 73268672ULL,
+    73400128ULL, 73530944ULL, 73662272ULL, 73793344ULL,
+    73924544ULL, 74055104ULL, 74185792ULL, 74316992ULL,
+    74448832ULL, 74579392ULL, 74710976ULL, 74841664ULL,
+    74972864ULL, 75102784ULL, 75233344ULL, 75364544ULL,
+    75497024ULL, 75627584ULL, 75759296ULL, 75890624ULL,
+    76021696ULL, 76152256ULL, 76283072ULL, 76414144ULL,
+    76545856ULL, 76676672ULL, 76806976ULL, 76937792ULL,
+    77070016ULL, 77200832ULL, 77331392ULL, 77462464ULL,
+    77593664ULL, 77725376ULL, 77856448ULL, 77987776ULL,
+    78118336ULL, 78249664ULL, 78380992ULL, 78511424ULL,
+    78642496ULL, 78773056ULL, 78905152ULL, 79033664ULL,
+    79166656ULL, 79297472ULL, 79429568ULL, 79560512ULL,
+    79690816ULL, 79822784ULL, 79953472ULL, 80084672ULL,
+    80214208ULL, 80346944ULL, 80477632ULL, 80608576ULL,
+    80740288ULL, 80870848ULL, 81002048ULL, 81133504ULL,
+    81264448ULL, 81395648ULL, 81525952ULL, 81657536ULL,
+    81786304ULL, 81919808ULL, 82050112ULL, 82181312ULL,
+    82311616ULL, 82443968ULL, 82573376ULL, 82705984ULL,
+    82835776ULL, 82967744ULL, 83096768ULL, 83230528ULL,
+    83359552ULL, 83491264ULL, 83622464ULL, 83753536ULL,
+    83886016ULL, 84015296ULL, 84147776ULL, 84277184ULL,
+    84409792ULL, 84540608ULL, 84672064ULL, 84803008ULL,
+    84934336ULL, 85065152ULL, 85193792ULL, 85326784ULL,
+    85458496ULL, 85589312ULL, 85721024ULL, 85851968ULL,
+    85982656ULL, 86112448ULL, 86244416ULL, 86370112ULL,
+    86506688ULL, 86637632ULL, 86769344ULL, 86900672ULL,
+    87031744ULL, 87162304ULL, 87293632ULL, 87424576ULL,
+    87555392ULL, 87687104ULL, 87816896ULL, 87947968ULL,
+    88079168ULL, 88211264ULL, 88341824ULL, 88473152ULL,
+    88603712ULL, 88735424ULL, 88862912ULL, 88996672ULL,
+    89128384ULL, 89259712ULL, 89390272ULL, 89521984ULL,
+    89652544ULL, 89783872ULL, 89914816ULL, 90045376ULL,
+    90177088ULL, 90307904ULL, 90438848ULL, 90569152ULL,
+    90700096ULL, 90832832ULL, 90963776ULL, 91093696ULL,
+    91223744ULL, 91356992ULL, 91486784ULL, 91618496ULL,
+    91749824ULL, 91880384ULL, 92012224ULL, 92143552ULL,
+    92273344ULL, 92405696ULL, 92536768ULL, 92666432ULL,
+    92798912ULL, 92926016ULL, 93060544ULL, 93192128ULL,
+    93322816ULL, 93453632ULL, 93583936ULL, 93715136ULL,
+    93845056ULL, 93977792ULL, 94109504ULL, 94240448ULL,
+    94371776ULL, 94501184ULL, 94632896ULL, 94764224ULL,
+    94895552ULL, 95023424ULL, 95158208ULL, 95287744ULL,
+    95420224ULL, 95550016ULL, 95681216ULL, 95811904ULL,
+    95943872ULL, 96075328ULL, 96203584ULL, 96337856ULL,
+    96468544ULL, 96599744ULL, 96731072ULL, 96860992ULL,
+    96992576ULL, 97124288ULL, 97254848ULL, 97385536ULL,
+    97517248ULL, 97647808ULL, 97779392ULL, 97910464ULL,
+    98041408ULL, 98172608ULL, 98303168ULL, 98434496ULL,
+    98565568ULL, 98696768ULL, 98827328ULL, 98958784ULL,
+    99089728ULL, 99220928ULL, 99352384ULL, 99482816ULL,
+    99614272ULL, 99745472ULL, 99876416ULL, 100007104ULL,
+    100138048ULL, 100267072ULL, 100401088ULL, 100529984ULL,
+    100662592ULL, 100791872ULL, 100925248ULL, 101056064ULL,
+    101187392ULL, 101317952ULL, 101449408ULL, 101580608ULL,
+    101711296ULL, 101841728ULL, 101973824ULL, 102104896ULL,
+    102235712ULL, 102366016ULL, 102498112ULL, 102628672ULL,
+    102760384ULL, 102890432ULL, 103021888ULL, 103153472ULL,
+    103284032ULL, 103415744ULL, 103545152ULL, 103677248ULL,
+    103808576ULL, 103939648ULL, 104070976ULL, 104201792ULL,
+    104332736ULL, 104462528ULL, 104594752ULL, 104725952ULL,
+    104854592ULL, 104988608ULL, 105118912ULL, 105247808ULL,
+    105381184ULL, 105511232ULL, 105643072ULL, 105774784ULL,
+    105903296ULL, 106037056ULL, 106167872ULL, 106298944ULL,
+    106429504ULL, 106561472ULL, 106691392ULL, 106822592ULL,
+    106954304ULL, 107085376ULL, 107216576ULL, 107346368ULL,
+    107478464ULL, 107609792ULL, 107739712ULL, 107872192ULL,
+    108003136ULL, 108131392ULL, 108265408ULL, 108396224ULL,
+    108527168ULL, 108657344ULL, 108789568ULL, 108920384ULL,
+    109049792ULL, 109182272ULL, 109312576ULL, 109444928ULL,
+    109572928ULL, 109706944ULL, 109837888ULL, 109969088ULL,
+    110099648ULL, 110230976ULL, 110362432ULL, 110492992ULL,
+    110624704ULL, 110755264ULL, 110886208ULL, 111017408ULL,
+    111148864ULL, 111279296ULL, 111410752ULL, 111541952ULL,
+    111673024ULL, 111803456ULL, 111933632ULL, 112066496ULL,
+    112196416ULL, 112328512ULL, 112457792ULL, 112590784ULL,
+    112715968ULL, 112852672ULL, 112983616ULL, 113114944ULL,
+    113244224ULL, 113376448ULL, 113505472ULL, 113639104ULL,
+    113770304ULL, 113901376ULL, 114031552ULL, 114163264ULL,
+    114294592ULL, 114425536ULL, 114556864ULL, 114687424ULL,
+    114818624ULL, 114948544ULL, 115080512ULL, 115212224ULL,
+    115343296ULL, 115473472ULL, 115605184ULL, 115736128ULL,
+    115867072ULL, 115997248ULL, 116128576ULL, 116260288ULL,
+    116391488ULL, 116522944ULL, 116652992ULL, 116784704ULL,
+    116915648ULL, 117046208ULL, 117178304ULL, 117308608ULL,
+    117440192ULL, 117569728ULL, 117701824ULL, 117833024ULL,
+    117964096ULL, 118094656ULL, 118225984ULL, 118357312ULL,
+    118489024ULL, 118617536ULL, 118749632ULL, 118882112ULL,
+    119012416ULL, 119144384ULL, 119275328ULL, 119406016ULL,
+    119537344ULL, 119668672ULL, 119798464ULL, 119928896ULL,
+    120061376ULL, 120192832ULL, 120321728ULL, 120454336ULL,
+    120584512ULL, 120716608ULL, 120848192ULL, 120979136ULL,
+    121109056ULL, 121241408ULL, 121372352ULL, 121502912ULL,
+    121634752ULL, 121764416ULL, 121895744ULL, 122027072ULL,
+    122157632ULL, 122289088ULL, 122421184ULL, 122550592ULL,
+    122682944ULL, 122813888ULL, 122945344ULL, 123075776ULL,
+    123207488ULL, 123338048ULL, 123468736ULL, 123600704ULL,
+    123731264ULL, 123861952ULL, 123993664ULL, 124124608ULL,
+    124256192ULL, 124386368ULL, 124518208ULL, 124649024ULL,
+    124778048ULL, 124911296ULL, 125041088ULL, 125173696ULL,
+    125303744ULL, 125432896ULL, 125566912ULL, 125696576ULL,
+    125829056ULL, 125958592ULL, 126090304ULL, 126221248ULL,
+    126352832ULL, 126483776ULL, 126615232ULL, 126746432ULL,
+    126876608ULL, 127008704ULL, 127139392ULL, 127270336ULL,
+    127401152ULL, 127532224ULL, 127663552ULL, 127794752ULL,
+    127925696ULL, 128055232ULL, 128188096ULL, 128319424ULL,
+    128449856ULL, 128581312ULL, 128712256ULL, 128843584ULL,
+    128973632ULL, 129103808ULL, 129236288ULL, 129365696ULL,
+    129498944ULL, 129629888ULL, 129760832ULL, 129892288ULL,
+    130023104ULL, 130154048ULL, 130283968ULL, 130416448ULL,
+    130547008ULL, 130678336ULL, 130807616ULL, 130939456ULL,
+    131071552ULL, 131202112ULL, 131331776ULL, 131464384ULL,
+    131594048ULL, 131727296ULL, 131858368ULL, 131987392ULL,
+    132120256ULL, 132250816ULL, 132382528ULL, 132513728ULL,
+    132644672ULL, 132774976ULL, 132905792ULL, 133038016ULL,
+    133168832ULL, 133299392ULL, 133429312ULL, 133562048ULL,
+    133692992ULL, 133823296ULL, 133954624ULL, 134086336ULL,
+    134217152ULL, 134348608ULL, 134479808ULL, 134607296ULL,
+    134741056ULL, 134872384ULL, 135002944ULL, 135134144ULL,
+    135265472ULL, 135396544ULL, 135527872ULL, 135659072ULL,
+    135787712ULL, 135921472ULL, 136052416ULL, 136182848ULL,
+    136313792ULL, 136444864ULL, 136576448ULL, 136707904ULL,
+    136837952ULL, 136970048ULL, 137099584ULL, 137232064ULL,
+    137363392ULL, 137494208ULL, 137625536ULL, 137755712ULL,
+    137887424ULL, 138018368ULL, 138149824ULL, 138280256ULL,
+    138411584ULL, 138539584ULL, 138672832ULL, 138804928ULL,
+    138936128ULL, 139066688ULL, 139196864ULL, 139328704ULL,
+    139460032ULL, 139590208ULL, 139721024ULL, 139852864ULL,
+    139984576ULL, 140115776ULL, 140245696ULL, 140376512ULL,
+    140508352ULL, 140640064ULL, 140769856ULL, 140902336ULL,
+    141032768ULL, 141162688ULL, 141294016ULL, 141426496ULL,
+    141556544ULL, 141687488ULL, 141819584ULL, 141949888ULL,
+    142080448ULL, 142212544ULL, 142342336ULL, 142474432ULL,
+    142606144ULL, 142736192ULL, 142868288ULL, 142997824ULL,
+    143129408ULL, 143258944ULL, 143392448ULL, 143523136ULL,
+    143653696ULL, 143785024ULL, 143916992ULL, 144045632ULL,
+    144177856ULL, 144309184ULL, 144440768ULL, 144570688ULL,
+    144701888ULL, 144832448ULL, 144965056ULL, 145096384ULL,
+    145227584ULL, 145358656ULL, 145489856ULL, 145620928ULL,
+    145751488ULL, 145883072ULL, 146011456ULL, 146144704ULL,
+    146275264ULL, 146407232ULL, 146538176ULL, 146668736ULL,
+    146800448ULL, 146931392ULL, 147062336ULL, 147193664ULL,
+    147324224ULL, 147455936ULL, 147586624ULL, 147717056ULL,
+    147848768ULL, 147979456ULL, 148110784ULL, 148242368ULL,
+    148373312ULL, 148503232ULL, 148635584ULL, 148766144ULL,
+    148897088ULL, 149028416ULL, 149159488ULL, 149290688ULL,
+    149420224ULL, 149551552ULL, 149683136ULL, 149814976ULL,
+    149943616ULL, 150076352ULL, 150208064ULL, 150338624ULL,
+    150470464ULL, 150600256ULL, 150732224ULL, 150862784ULL,
+    150993088ULL, 151125952ULL, 151254976ULL, 151388096ULL,
+    151519168ULL, 151649728ULL, 151778752ULL, 151911104ULL,
+    152042944ULL, 152174144ULL, 152304704ULL, 152435648ULL,
+    152567488ULL, 152698816ULL, 152828992ULL, 152960576ULL,
+    153091648ULL, 153222976ULL, 153353792ULL, 153484096ULL,
+    153616192ULL, 153747008ULL, 153878336ULL, 154008256ULL,
+    154139968ULL, 154270912ULL, 154402624ULL, 154533824ULL,
+    154663616ULL, 154795712ULL, 154926272ULL, 155057984ULL,
+    155188928ULL, 155319872ULL, 155450816ULL, 155580608ULL,
+    155712064ULL, 155843392ULL, 155971136ULL, 156106688ULL,
+    156237376ULL, 156367424ULL, 156499264ULL, 156630976ULL,
+    156761536ULL, 156892352ULL, 157024064ULL, 157155008ULL,
+    157284416ULL, 157415872ULL, 157545536ULL, 157677248ULL,
+    157810496ULL, 157938112ULL, 158071744ULL, 158203328ULL,
+    158334656ULL, 158464832ULL, 158596288ULL, 158727616ULL,
+    158858048ULL, 158988992ULL, 159121216ULL, 159252416ULL,
+    159381568ULL, 159513152ULL, 159645632ULL, 159776192ULL,
+    159906496ULL, 160038464ULL, 160169536ULL, 160300352ULL,
+    160430656ULL, 160563008ULL, 160693952ULL, 160822208ULL,
+    160956352ULL, 161086784ULL, 161217344ULL, 161349184ULL,
+    161480512ULL, 161611456ULL, 161742272ULL, 161873216ULL,
+    162002752ULL, 162135872ULL, 162266432ULL, 162397888ULL,
+    162529216ULL, 162660032ULL, 162790976ULL, 162922048ULL,
+    163052096ULL, 163184576ULL, 163314752ULL, 163446592ULL,
+    163577408ULL, 163707968ULL, 163839296ULL, 163969984ULL,
+    164100928ULL, 164233024ULL, 164364224ULL, 164494912ULL,
+    164625856ULL, 164756672ULL, 164887616ULL, 165019072ULL,
+    165150016ULL, 165280064ULL, 165412672ULL, 165543104ULL,
+    165674944ULL, 165805888ULL, 165936832ULL, 166067648ULL,
+    166198336ULL, 166330048ULL, 166461248ULL, 166591552ULL,
+    166722496ULL, 166854208ULL, 166985408ULL, 167116736ULL,
+    167246656ULL, 167378368ULL, 167508416ULL, 167641024ULL,
+    167771584ULL, 167903168ULL, 168034112ULL, 168164032ULL,
+    168295744ULL, 168427456ULL, 168557632ULL, 168688448ULL,
+    168819136ULL, 168951616ULL, 169082176ULL, 169213504ULL,
+    169344832ULL, 169475648ULL, 169605952ULL, 169738048ULL,
+    169866304ULL, 169999552ULL, 170131264ULL, 170262464ULL,
+    170393536ULL, 170524352ULL, 170655424ULL, 170782016ULL,
+    170917696ULL, 171048896ULL, 171179072ULL, 171310784ULL,
+    171439936ULL, 171573184ULL, 171702976ULL, 171835072ULL,
+    171966272ULL, 172097216ULL, 172228288ULL, 172359232ULL,
+    172489664ULL, 172621376ULL, 172747712ULL, 172883264ULL,
+    173014208ULL, 173144512ULL, 173275072ULL, 173407424ULL,
+    173539136ULL, 173669696ULL, 173800768ULL, 173931712ULL,
+    174063424ULL, 174193472ULL, 174325696ULL, 174455744ULL,
+    174586816ULL, 174718912ULL, 174849728ULL, 174977728ULL,
+    175109696ULL, 175242688ULL, 175374272ULL, 175504832ULL,
+    175636288ULL, 175765696ULL, 175898432ULL, 176028992ULL,
+    176159936ULL, 176291264ULL, 176422592ULL, 176552512ULL,
+    176684864ULL, 176815424ULL, 176946496ULL, 177076544ULL,
+    177209152ULL, 177340096ULL, 177470528ULL, 177600704ULL,
+    177731648ULL, 177864256ULL, 177994816ULL, 178126528ULL,
+    178257472ULL, 178387648ULL, 178518464ULL, 178650176ULL,
+    178781888ULL, 178912064ULL, 179044288ULL, 179174848ULL,
+    179305024ULL, 179436736ULL, 179568448ULL, 179698496ULL,
+    179830208ULL, 179960512ULL, 180092608ULL, 180223808ULL,
+    180354752ULL, 180485696ULL, 180617152ULL, 180748096ULL,
+    180877504ULL, 181009984ULL, 181139264ULL, 181272512ULL,
+    181402688ULL, 181532608ULL, 181663168ULL, 181795136ULL,
+    181926592ULL, 182057536ULL, 182190016ULL, 182320192ULL,
+    182451904ULL, 182582336ULL, 182713792ULL, 182843072ULL,
+    182976064ULL, 183107264ULL, 183237056ULL, 183368384ULL,
+    183494848ULL, 183631424ULL, 183762752ULL, 183893824ULL,
+    184024768ULL, 184154816ULL, 184286656ULL, 184417984ULL,
+    184548928ULL, 184680128ULL, 184810816ULL, 184941248ULL,
+    185072704ULL, 185203904ULL, 185335616ULL, 185465408ULL,
+    185596352ULL, 185727296ULL, 185859904ULL, 185989696ULL,
+    186121664ULL, 186252992ULL, 186383552ULL, 186514112ULL,
+    186645952ULL, 186777152ULL, 186907328ULL, 187037504ULL,
+    187170112ULL, 187301824ULL, 187429184ULL, 187562048ULL,
+    187693504ULL, 187825472ULL, 187957184ULL, 188087104ULL,
+    188218304ULL, 188349376ULL, 188481344ULL, 188609728ULL,
+    188743616ULL, 188874304ULL, 189005248ULL, 189136448ULL,
+    189265088ULL, 189396544ULL, 189528128ULL, 189660992ULL,
+    189791936ULL, 189923264ULL, 190054208ULL, 190182848ULL,
+    190315072ULL, 190447424ULL, 190577984ULL, 190709312ULL,
+    190840768ULL, 190971328ULL, 191102656ULL, 191233472ULL,
+    191364032ULL, 191495872ULL, 191626816ULL, 191758016ULL,
+    191888192ULL, 192020288ULL, 192148928ULL, 192282176ULL,
+    192413504ULL, 192542528ULL, 192674752ULL, 192805952ULL,
+    192937792ULL, 193068608ULL, 193198912ULL, 193330496ULL,
+    193462208ULL, 193592384ULL, 193723456ULL, 193854272ULL,
+    193985984ULL, 194116672ULL, 194247232ULL, 194379712ULL,
+    194508352ULL, 194641856ULL, 194772544ULL, 194900672ULL,
+    195035072ULL, 195166016ULL, 195296704ULL, 195428032ULL,
+    195558592ULL, 195690304ULL, 195818176ULL, 195952576ULL,
+    196083392ULL, 196214336ULL, 196345792ULL, 196476736ULL,
+    196607552ULL, 196739008ULL, 196869952ULL, 197000768ULL,
+    197130688ULL, 197262784ULL, 197394368ULL, 197523904ULL,
+    197656384ULL, 197787584ULL, 197916608ULL, 198049472ULL,
+    198180544ULL, 198310208ULL, 198442432ULL, 198573632ULL,
+    198705088ULL, 198834368ULL, 198967232ULL, 199097792ULL,
+    199228352ULL, 199360192ULL, 199491392ULL, 199621696ULL,
+    199751744ULL, 199883968ULL, 200014016ULL, 200146624ULL,
+    200276672ULL, 200408128ULL, 200540096ULL, 200671168ULL,
+    200801984ULL, 200933312ULL, 201062464ULL, 201194944ULL,
+    201326144ULL, 201457472ULL, 201588544ULL, 201719744ULL,
+    201850816ULL, 201981632ULL, 202111552ULL, 202244032ULL,
+    202374464ULL, 202505152ULL, 202636352ULL, 202767808ULL,
+    202898368ULL, 203030336ULL, 203159872ULL, 203292608ULL,
+    203423296ULL, 203553472ULL, 203685824ULL, 203816896ULL,
+    203947712ULL, 204078272ULL, 204208192ULL, 204341056ULL,
+    204472256ULL, 204603328ULL, 204733888ULL, 204864448ULL,
+    204996544ULL, 205125568ULL, 205258304ULL, 205388864ULL,
+    205517632ULL, 205650112ULL, 205782208ULL, 205913536ULL,
+    206044736ULL, 206176192ULL, 206307008ULL, 206434496ULL,
+    206569024ULL, 206700224ULL, 206831168ULL, 206961856ULL,
+    207093056ULL, 207223616ULL, 207355328ULL, 207486784ULL,
+    207616832ULL, 207749056ULL, 207879104ULL, 208010048ULL,
+    208141888ULL, 208273216ULL, 208404032ULL, 208534336ULL,
+    208666048ULL, 208796864ULL, 208927424ULL, 209059264ULL,
+    209189824ULL, 209321792ULL, 209451584ULL, 209582656ULL,
+    209715136ULL, 209845568ULL, 209976896ULL, 210106432ULL,
+    210239296ULL, 210370112ULL, 210501568ULL, 210630976ULL,
+    210763712ULL, 210894272ULL, 211024832ULL, 211156672ULL,
+    211287616ULL, 211418176ULL, 211549376ULL, 211679296ULL,
+    211812032ULL, 211942592ULL, 212074432ULL, 212204864ULL,
+    212334016ULL, 212467648ULL, 212597824ULL, 212727616ULL,
+    212860352ULL, 212991424ULL, 213120832ULL, 213253952ULL,
+    213385024ULL, 213515584ULL, 213645632ULL, 213777728ULL,
+    213909184ULL, 214040128ULL, 214170688ULL, 214302656ULL,
+    214433728ULL, 214564544ULL, 214695232ULL, 214826048ULL,
+    214956992ULL, 215089088ULL, 215219776ULL, 215350592ULL,
+    215482304ULL, 215613248ULL, 215743552ULL, 215874752ULL,
+    216005312ULL, 216137024ULL, 216267328ULL, 216399296ULL,
+    216530752ULL, 216661696ULL, 216790592ULL, 216923968ULL,
+    217054528ULL, 217183168ULL, 217316672ULL, 217448128ULL,
+    217579072ULL, 217709504ULL, 217838912ULL, 217972672ULL,
+    218102848ULL, 218233024ULL, 218364736ULL, 218496832ULL,
+    218627776ULL, 218759104ULL, 218888896ULL, 219021248ULL,
+    219151936ULL, 219281728ULL, 219413056ULL, 219545024ULL,
+    219675968ULL, 219807296ULL, 219938624ULL, 220069312ULL,
+    220200128ULL, 220331456ULL, 220461632ULL, 220592704ULL,
+    220725184ULL, 220855744ULL, 220987072ULL, 221117888ULL,
+    221249216ULL, 221378368ULL, 221510336ULL, 221642048ULL,
+    221772736ULL, 221904832ULL, 222031808ULL, 222166976ULL,
+    222297536ULL, 222428992ULL, 222559936ULL, 222690368ULL,
+    222820672ULL, 222953152ULL, 223083968ULL, 223213376ULL,
+    223345984ULL, 223476928ULL, 223608512ULL, 223738688ULL,
+    223869376ULL, 224001472ULL, 224132672ULL, 224262848ULL,
+    224394944ULL, 224524864ULL, 224657344ULL, 224788288ULL,
+    224919488ULL, 225050432ULL, 225181504ULL, 225312704ULL,
+    225443776ULL, 225574592ULL, 225704768ULL, 225834176ULL,
+    225966784ULL, 226097216ULL, 226229824ULL, 226360384ULL,
+    226491712ULL, 226623424ULL, 226754368ULL, 226885312ULL,
+    227015104ULL, 227147456ULL, 227278528ULL, 227409472ULL,
+    227539904ULL, 227669696ULL, 227802944ULL, 227932352ULL,
+    228065216ULL, 228196288ULL, 228326464ULL, 228457792ULL,
+    228588736ULL, 228720064ULL, 228850112ULL, 228981056ULL,
+    229113152ULL, 229243328ULL, 229375936ULL, 229505344ULL,
+    229636928ULL, 229769152ULL, 229894976ULL, 230030272ULL,
+    230162368ULL, 230292416ULL, 230424512ULL, 230553152ULL,
+    230684864ULL, 230816704ULL, 230948416ULL, 231079616ULL,
+    231210944ULL, 231342016ULL, 231472448ULL, 231603776ULL,
+    231733952ULL, 231866176ULL, 231996736ULL, 232127296ULL,
+    232259392ULL, 232388672ULL, 232521664ULL, 232652608ULL,
+    232782272ULL, 232914496ULL, 233043904ULL, 233175616ULL,
+    233306816ULL, 233438528ULL, 233569984ULL, 233699776ULL,
+    233830592ULL, 233962688ULL, 234092224ULL, 234221888ULL,
+    234353984ULL, 234485312ULL, 234618304ULL, 234749888ULL,
+    234880832ULL, 235011776ULL, 235142464ULL, 235274048ULL,
+    235403456ULL, 235535936ULL, 235667392ULL, 235797568ULL,
+    235928768ULL, 236057152ULL, 236190272ULL, 236322752ULL,
+    236453312ULL, 236583616ULL, 236715712ULL, 236846528ULL,
+    236976448ULL, 237108544ULL, 237239104ULL, 237371072ULL,
+    237501632ULL, 237630784ULL, 237764416ULL, 237895232ULL,
+    238026688ULL, 238157632ULL, 238286912ULL, 238419392ULL,
+    238548032ULL, 238681024ULL, 238812608ULL, 238941632ULL,
+    239075008ULL, 239206336ULL, 239335232ULL, 239466944ULL,
+    239599168ULL, 239730496ULL, 239861312ULL, 239992384ULL,
+    240122816ULL, 240254656ULL, 240385856ULL, 240516928ULL,
+    240647872ULL, 240779072ULL, 240909632ULL, 241040704ULL,
+    241171904ULL, 241302848ULL, 241433408ULL, 241565248ULL,
+    241696192ULL, 241825984ULL, 241958848ULL, 242088256ULL,
+    242220224ULL, 242352064ULL, 242481856ULL, 242611648ULL,
+    242744896ULL, 242876224ULL, 243005632ULL, 243138496ULL,
+    243268672ULL, 243400384ULL, 243531712ULL, 243662656ULL,
+    243793856ULL, 243924544ULL, 244054592ULL, 244187072ULL,
+    244316608ULL, 244448704ULL, 244580032ULL, 244710976ULL,
+    244841536ULL, 244972864ULL, 245104448ULL, 245233984ULL,
+    245365312ULL, 245497792ULL, 245628736ULL, 245759936ULL,
+    245889856ULL, 246021056ULL, 246152512ULL, 246284224ULL,
+    246415168ULL, 246545344ULL, 246675904ULL, 246808384ULL,
+    246939584ULL, 247070144ULL, 247199552ULL, 247331648ULL,
+    247463872ULL, 247593536ULL, 247726016ULL, 247857088ULL,
+    247987648ULL, 248116928ULL, 248249536ULL, 248380736ULL,
+    248512064ULL, 248643008ULL, 248773312ULL, 248901056ULL,
+    249036608ULL, 249167552ULL, 249298624ULL, 249429184ULL,
+    249560512ULL, 249692096ULL, 249822784ULL, 249954112ULL,
+    250085312ULL, 250215488ULL, 250345792ULL, 250478528ULL,
+    250608704ULL, 250739264ULL, 250870976ULL, 251002816ULL,
+    251133632ULL, 251263552ULL, 251395136ULL, 251523904ULL,
+    251657792ULL, 251789248ULL, 251919424ULL, 252051392ULL,
+    252182464ULL, 252313408ULL, 252444224ULL, 252575552ULL,
+    252706624ULL, 252836032ULL, 252968512ULL, 253099712ULL,
+    253227584ULL, 253361728ULL, 253493056ULL, 253623488ULL,
+    253754432ULL, 253885504ULL, 254017216ULL, 254148032ULL,
+    254279488ULL, 254410432ULL, 254541376ULL, 254672576ULL,
+    254803264ULL, 254933824ULL, 255065792ULL, 255196736ULL,
+    255326528ULL, 255458752ULL, 255589952ULL, 255721408ULL,
+    255851072ULL, 255983296ULL, 256114624ULL, 256244416ULL,
+    256374208ULL, 256507712ULL, 256636096ULL, 256768832ULL,
+    256900544ULL, 257031616ULL, 257162176ULL, 257294272ULL,
+    257424448ULL, 257555776ULL, 257686976ULL, 257818432ULL,
+    257949632ULL, 258079552ULL, 258211136ULL, 258342464ULL,
+    258473408ULL, 258603712ULL, 258734656ULL, 258867008ULL,
+    258996544ULL, 259127744ULL, 259260224ULL, 259391296ULL,
+    259522112ULL, 259651904ULL, 259784384ULL, 259915328ULL,
+    260045888ULL, 260175424ULL, 260308544ULL, 260438336ULL,
+    260570944ULL, 260700992ULL, 260832448ULL, 260963776ULL,
+    261092672ULL, 261226304ULL, 261356864ULL, 261487936ULL,
+    261619648ULL, 261750592ULL, 261879872ULL, 262011968ULL,
+    262143424ULL, 262274752ULL, 262404416ULL, 262537024ULL,
+    262667968ULL, 262799296ULL, 262928704ULL, 263061184ULL,
+    263191744ULL, 263322944ULL, 263454656ULL, 263585216ULL,
+    263716672ULL, 263847872ULL, 263978944ULL, 264108608ULL,
+    264241088ULL, 264371648ULL, 264501184ULL, 264632768ULL,
+    264764096ULL, 264895936ULL, 265024576ULL, 265158464ULL,
+    265287488ULL, 265418432ULL, 265550528ULL, 265681216ULL,
+    265813312ULL, 265943488ULL, 266075968ULL, 266206144ULL,
+    266337728ULL, 266468032ULL, 266600384ULL, 266731072ULL,
+    266862272ULL, 266993344ULL, 267124288ULL, 267255616ULL,
+    267386432ULL, 267516992ULL, 267648704ULL, 267777728ULL,
+    267910592ULL, 268040512ULL, 268172096ULL, 268302784ULL,
+    268435264ULL, 268566208ULL, 268696256ULL, 268828096ULL,
+    268959296ULL, 269090368ULL, 269221312ULL, 269352256ULL,
+    269482688ULL, 269614784ULL, 269745856ULL, 269876416ULL,
+    270007616ULL, 270139328ULL, 270270272ULL, 270401216ULL,
+    270531904ULL, 270663616ULL, 270791744ULL, 270924736ULL,
+    271056832ULL, 271186112ULL, 271317184ULL, 271449536ULL,
+    271580992ULL, 271711936ULL, 271843136ULL, 271973056ULL,
+    272105408ULL, 272236352ULL, 272367296ULL, 272498368ULL,
+    272629568ULL, 272759488ULL, 272891456ULL, 273022784ULL,
+    273153856ULL, 273284672ULL, 273415616ULL, 273547072ULL,
+    273677632ULL, 273808448ULL, 273937088ULL, 274071488ULL,
+    274200896ULL, 274332992ULL, 274463296ULL, 274595392ULL,
+    274726208ULL, 274857536ULL, 274988992ULL, 275118656ULL,
+    275250496ULL, 275382208ULL, 275513024ULL, 275643968ULL,
+    275775296ULL, 275906368ULL, 276037184ULL, 276167872ULL,
+    276297664ULL, 276429376ULL, 276560576ULL, 276692672ULL,
+    276822976ULL, 276955072ULL, 277085632ULL, 277216832ULL,
+    277347008ULL, 277478848ULL, 277609664ULL, 277740992ULL,
+    277868608ULL, 278002624ULL, 278134336ULL, 278265536ULL,
+    278395328ULL, 278526784ULL, 278657728ULL, 278789824ULL,
+    278921152ULL, 279052096ULL, 279182912ULL, 279313088ULL,
+    279443776ULL, 279576256ULL, 279706048ULL, 279838528ULL,
+    279969728ULL, 280099648ULL, 280230976ULL, 280361408ULL,
+    280493632ULL, 280622528ULL, 280755392ULL, 280887104ULL,
+    281018176ULL, 281147968ULL, 281278912ULL, 281411392ULL,
+    281542592ULL, 281673152ULL, 281803712ULL, 281935552ULL,
+    282066496ULL, 282197312ULL, 282329024ULL, 282458816ULL,
+    282590272ULL, 282720832ULL, 282853184ULL, 282983744ULL,
+    283115072ULL, 283246144ULL, 283377344ULL, 283508416ULL,
+    283639744ULL, 283770304ULL, 283901504ULL, 284032576ULL,
+    284163136ULL, 284294848ULL, 284426176ULL, 284556992ULL,
+    284687296ULL, 284819264ULL, 284950208ULL, 285081536ULL,
+};
+
+static const uint64_t dataset_sizes[SIZE_TABLE_EPOCHS] = {
+    1073739904ULL, 1082130304ULL, 1090514816ULL, 1098906752ULL,
+    1107293056ULL, 1115684224ULL, 1124070016ULL, 1132461952ULL,
+    1140849536ULL, 1149232768ULL, 1157627776ULL, 1166013824ULL,
+    1174404736ULL, 1182786944ULL, 1191180416ULL, 1199568512ULL,
+    1207958912ULL, 1216345216ULL, 1224732032ULL, 1233124736ULL,
+    1241513344ULL, 1249902464ULL, 1258290304ULL, 1266673792ULL,
+    1275067264ULL, 1283453312ULL, 1291844992ULL, 1300234112ULL,
+    1308619904ULL, 1317010048ULL, 1325397376ULL, 1333787776ULL,
+    1342176128ULL, 1350561664ULL, 1358954368ULL, 1367339392ULL,
+    1375731584ULL, 1384118144ULL, 1392507008ULL, 1400897408ULL,
+    1409284736ULL, 1417673344ULL, 1426062464ULL, 1434451072ULL,
+    1442839168ULL, 1451229056ULL, 1459615616ULL, 1468006016ULL,
+    1476394112ULL, 1484782976ULL, 1493171584ULL, 1501559168ULL,
+    1509948032ULL, 1518337664ULL, 1526726528ULL, 1535114624ULL,
+    1543503488ULL, 1551892096ULL, 1560278656ULL, 1568669056ULL,
+    1577056384ULL, 1585446272ULL, 1593831296ULL, 1602219392ULL,
+    1610610304ULL, 1619000192ULL, 1627386752ULL, 1635773824ULL,
+    1644164224ULL, 1652555648ULL, 1660943488ULL, 1669332608ULL,
+    1677721216ULL, 1686109312ULL, 1694497664ULL, 1702886272ULL,
+    1711274624ULL, 1719661184ULL, 1728047744ULL, 1736434816ULL,
+    1744829056ULL, 1753218944ULL, 1761606272ULL, 1769995904ULL,
+    1778382464ULL, 1786772864ULL, 1795157888ULL, 1803550592ULL,
+    1811937664ULL, 1820327552ULL, 1828711552ULL, 1837102976ULL,
+    1845488768ULL, 1853879936ULL, 1862269312ULL, 1870656896ULL,
+    1879048064ULL, 1887431552ULL, 1895825024ULL, 1904212096ULL,
+    1912601216ULL, 1920988544ULL, 1929379456ULL, 1937765504ULL,
+    1946156672ULL, 1954543232ULL, 1962932096ULL, 1971321728ULL,
+    1979707264ULL, 1988093056ULL, 1996487552ULL, 2004874624ULL,
+    2013262208ULL, 2021653888ULL, 2030039936ULL, 2038430848ULL,
+    2046819968ULL, 2055208576ULL, 2063596672ULL, 2071981952ULL,
+    2080373632ULL, 2088762752ULL, 2097149056ULL, 2105539712ULL,
+    2113928576ULL, 2122315136ULL, 2130700672ULL, 2139092608ULL,
+    2147483264ULL, 2155872128ULL, 2164257664ULL, 2172642176ULL,
+    2181035392ULL, 2189426048ULL, 2197814912ULL, 2206203008ULL,
+    2214587264ULL, 2222979712ULL, 2231367808ULL, 2239758208ULL,
+    2248145024ULL, 2256527744ULL, 2264922752ULL, 2273312128ULL,
+    2281701248ULL, 2290086272ULL, 2298476672ULL, 2306867072ULL,
+    2315251072ULL, 2323639168ULL, 2332032128ULL, 2340420224ULL,
+    2348808064ULL, 2357196416ULL, 2365580416ULL, 2373966976ULL,
+    2382363008ULL, 2390748544ULL, 2399139968ULL, 2407530368ULL,
+    2415918976ULL, 2424307328ULL, 2432695424ULL, 2441084288ULL,
+    2449472384ULL, 2457861248ULL, 2466247808ULL, 2474637184ULL,
+    2483026816ULL, 2491414144ULL, 2499803776ULL, 2508191872ULL,
+    2516582272ULL, 2524970368ULL, 2533359232ULL, 2541743488ULL,
+    2550134144ULL, 2558525056ULL, 2566913408ULL, 2575301504ULL,
+    2583686528ULL, 2592073856ULL, 2600467328ULL, 2608856192ULL,
+    2617240448ULL, 2625631616ULL, 2634022016ULL, 2642407552ULL,
+    2650796416ULL, 2659188352ULL, 2667574912ULL, 2675965312ULL,
+    2684352896ULL, 2692738688ULL, 2701130624ULL, 2709518464ULL,
+    2717907328ULL, 2726293376ULL, 2734685056ULL, 2743073152ULL,
+    2751462016ULL, 2759851648ULL, 2768232832ULL, 2776625536ULL,
+    2785017728ULL, 2793401984ULL, 2801794432ULL, 2810182016ULL,
+    2818571648ULL, 2826959488ULL, 2835349376ULL, 2843734144ULL,
+    2852121472ULL, 2860514432ULL, 2868900992ULL, 2877286784ULL,
+    2885676928ULL, 2894069632ULL, 2902451584ULL, 2910843008ULL,
+    2919234688ULL, 2927622784ULL, 2936011648ULL, 2944400768ULL,
+    2952789376ULL, 2961177728ULL, 2969565568ULL, 2977951616ULL,
+    2986338944ULL, 2994731392ULL, 3003120256ULL, 3011508352ULL,
+    3019895936ULL, 3028287104ULL, 3036675968ULL, 3045063808ULL,
+    3053452928ULL, 3061837696ULL, 3070228352ULL, 3078615424ULL,
+    3087003776ULL, 3095394944ULL, 3103782272ULL, 3112173184ULL,
+    3120562048ULL, 3128944768ULL, 3137339264ULL, 3145725056ULL,
+    3154109312ULL, 3162505088ULL, 3170893184ULL, 3179280256ULL,
+    3187669376ULL, 3196056704ULL, 3204445568ULL, 3212836736ULL,
+    3221224064ULL, 3229612928ULL, 3238002304ULL, 3246391168ULL,
+    3254778496ULL, 3263165824ULL, 3271556224ULL, 3279944576ULL,
+    3288332416ULL, 3296719232ULL, 3305110912ULL, 3313500032ULL,
+    3321887104ULL, 3330273152ULL, 3338658944ULL, 3347053184ULL,
+    3355440512ULL, 3363827072ULL, 3372220288ULL, 3380608384ULL,
+    3388997504ULL, 3397384576ULL, 3405774208ULL, 3414163072ULL,
+    3422551936ULL, 3430937984ULL, 3439328384ULL, 3447714176ULL,
+    3456104576ULL, 3464493952ULL, 3472883584ULL, 3481268864ULL,
+    3489655168ULL, 3498048896ULL, 3506434432ULL, 3514826368ULL,
+    3523213952ULL, 3531603584ULL, 3539987072ULL, 3548380288ULL,
+    3556763264ULL, 3565157248ULL, 3573545344ULL, 3581934464ULL,
+    3590324096ULL, 3598712704ULL, 3607098752ULL, 3615488384ULL,
+    3623877248ULL, 3632265856ULL, 3640646528ULL, 3649043584ULL,
+    3657430144ULL, 3665821568ULL, 3674207872ULL, 3682597504ULL,
+    3690984832ULL, 3699367808ULL, 3707764352ULL, 3716152448ULL,
+    3724541056ULL, 3732925568ULL, 3741318016ULL, 3749706368ULL,
+    3758091136ULL, 3766481536ULL, 3774872704ULL, 3783260032ULL,
+    3791650432ULL, 3800036224ULL, 3808427648ULL, 3816815488ULL,
+    3825204608ULL, 3833592704ULL, 3841981568ULL, 3850370432ULL,
+    3858755968ULL, 3867147904ULL, 3875536256ULL, 3883920512ULL,
+    3892313728ULL, 3900702592ULL, 3909087872ULL, 3917478784ULL,
+    3925868416ULL, 3934256512ULL, 3942645376ULL, 3951032192ULL,
+    3959422336ULL, 3967809152ULL, 3976200064ULL, 3984588416ULL,
+    3992974976ULL, 4001363584ULL, 4009751168ULL, 4018141312ULL,
+    4026530432ULL, 4034911616ULL, 4043308928ULL, 4051695488ULL,
+    4060084352ULL, 4068472448ULL, 4076862848ULL, 4085249408ULL,
+    4093640576ULL, 4102028416ULL, 4110413696ULL, 4118805632ULL,
+    4127194496ULL, 4135583104ULL, 4143971968ULL, 4152360832ULL,
+    4160746112ULL, 4169135744ULL, 4177525888ULL, 4185912704ULL,
+    4194303616ULL, 4202691968ULL, 4211076736ULL, 4219463552ULL,
+    4227855488ULL, 4236246656ULL, 4244633728ULL, 4253022848ULL,
+    4261412224ULL, 4269799808ULL, 4278184832ULL, 4286578048ULL,
+    4294962304ULL, 4303349632ULL, 4311743104ULL, 4320130432ULL,
+    4328521088ULL, 4336909184ULL, 4345295488ULL, 4353687424ULL,
+    4362073472ULL, 4370458496ULL, 4378852736ULL, 4387238528ULL,
+    4395630208ULL, 4404019072ULL, 4412407424ULL, 4420790656ULL,
+    4429182848ULL, 4437571456ULL, 4445962112ULL, 4454344064ULL,
+    4462738048ULL, 4471119232ULL, 4479516544ULL, 4487904128ULL,
+    4496289664ULL, 4504682368ULL, 4513068416ULL, 4521459584ULL,
+    4529846144ULL, 4538232704ULL, 4546619776ULL, 4555010176ULL,
+    4563402112ULL, 4571790208ULL, 4580174464ULL, 4588567936ULL,
+    4596957056ULL, 4605344896ULL, 4613734016ULL, 4622119808ULL,
+    4630511488ULL, 4638898816ULL, 4647287936ULL, 4655675264ULL,
+    4664065664ULL, 4672451968ULL, 4680842624ULL, 4689231488ULL,
+    4697620352ULL, 4706007424ULL, 4714397056ULL, 4722786176ULL,
+    4731173248ULL, 4739562368ULL, 4747951744ULL, 4756340608ULL,
+    4764727936ULL, 4773114496ULL, 4781504384ULL, 4789894784ULL,
+    4798283648ULL, 4806667648ULL, 4815059584ULL, 4823449472ULL,
+    4831835776ULL, 4840226176ULL, 4848612224ULL, 4857003392ULL,
+    4865391488ULL, 4873780096ULL, 4882169728ULL, 4890557312ULL,
+    4898946944ULL, 4907333248ULL, 4915722368ULL, 4924110976ULL,
+    4932499328ULL, 4940889728ULL, 4949276032ULL, 4957666432ULL,
+    4966054784ULL, 4974438016ULL, 4982831488ULL, 4991221376ULL,
+    4999607168ULL, 5007998848ULL, 5016386432ULL, 5024763776ULL,
+    5033164672ULL, 5041544576ULL, 5049941888ULL, 5058329728ULL,
+    5066717056ULL, 5075107456ULL, 5083494272ULL, 5091883904ULL,
+    5100273536ULL, 5108662144ULL, 5117048192ULL, 5125436032ULL,
+    5133827456ULL, 5142215296ULL, 5150605184ULL, 5158993024ULL,
+    5167382144ULL, 5175769472ULL, 5184157568ULL, 5192543872ULL,
+    5200936064ULL, 5209324928ULL, 5217711232ULL, 5226102656ULL,
+    5234490496ULL, 5242877312ULL, 5251263872ULL, 5259654016ULL,
+    5268040832ULL, 5276434304ULL, 5284819328ULL, 5293209728ULL,
+    5301598592ULL, 5309986688ULL, 5318374784ULL, 5326764416ULL,
+    5335151488ULL, 5343542144ULL, 5351929472ULL, 5360319872ULL,
+    5368706944ULL, 5377096576ULL, 5385484928ULL, 5393871232ULL,
+    5402263424ULL, 5410650496ULL, 5419040384ULL, 5427426944ULL,
+    5435816576ULL, 5444205952ULL, 5452594816ULL, 5460981376ULL,
+    5469367936ULL, 5477760896ULL, 5486148736ULL, 5494536832ULL,
+    5502925952ULL, 5511315328ULL, 5519703424ULL, 5528089984ULL,
+    5536481152ULL, 5544869504ULL, 5553256064ULL, 5561645696ULL,
+    5570032768ULL, 5578423936ULL, 5586811264ULL, 5595193216ULL,
+    5603585408ULL, 5611972736ULL, 5620366208ULL, 5628750464ULL,
+    5637143936ULL, 5645528192ULL, 5653921408ULL, 5662310272ULL,
+    5670694784ULL, 5679082624ULL, 5687474048ULL, 5695864448ULL,
+    5704251008ULL, 5712641408ULL, 5721030272ULL, 5729416832ULL,
+    5737806208ULL, 5746194304ULL, 5754583936ULL, 5762969984ULL,
+    5771358592ULL, 5779748224ULL, 5788137856ULL, 5796527488ULL,
+    5804911232ULL, 5813300608ULL, 5821692544ULL, 5830082176ULL,
+    5838468992ULL, 5846855552ULL, 5855247488ULL, 5863636096ULL,
+    5872024448ULL, 5880411008ULL, 5888799872ULL, 5897186432ULL,
+    5905576832ULL, 5913966976ULL, 5922352768ULL, 5930744704ULL,
+    5939132288ULL, 5947522432ULL, 5955911296ULL, 5964299392ULL,
+    5972688256ULL, 5981074304ULL, 5989465472ULL, 5997851008ULL,
+    6006241408ULL, 6014627968ULL, 6023015552ULL, 6031408256ULL,
+    6039796096ULL, 6048185216ULL, 6056574848ULL, 6064963456ULL,
+    6073351808ULL, 6081736064ULL, 6090128768ULL, 6098517632ULL,
+    6106906496ULL, 6115289216ULL, 6123680896ULL, 6132070016ULL,
+    6140459648ULL, 6148849024ULL, 6157237376ULL, 6165624704ULL,
+    6174009728ULL, 6182403712ULL, 6190792064ULL, 6199176064ULL,
+    6207569792ULL, 6215952256ULL, 6224345216ULL, 6232732544ULL,
+    6241124224ULL, 6249510272ULL, 6257899136ULL, 6266287744ULL,
+    6274676864ULL, 6283065728ULL, 6291454336ULL, 6299843456ULL,
+    6308232064ULL, 6316620928ULL, 6325006208ULL, 6333395584ULL,
+    6341784704ULL, 6350174848ULL, 6358562176ULL, 6366951296ULL,
+    6375337856ULL, 6383729536ULL, 6392119168ULL, 6400504192ULL,
+    6408895616ULL, 6417283456ULL, 6425673344ULL, 6434059136ULL,
+    6442444672ULL, 6450837376ULL, 6459223424ULL, 6467613056ULL,
+    6476004224ULL, 6484393088ULL, 6492781952ULL, 6501170048ULL,
+    6509555072ULL, 6517947008ULL, 6526336384ULL, 6534725504ULL,
+    6543112832ULL, 6551500672ULL, 6559888768ULL, 6568278656ULL,
+    6576662912ULL, 6585055616ULL, 6593443456ULL, 6601834112ULL,
+    6610219648ULL, 6618610304ULL, 6626999168ULL, 6635385472ULL,
+    6643777408ULL, 6652164224ULL, 6660552832ULL, 6668941952ULL,
+    6677330048ULL, 6685719424ULL, 6694107776ULL, 6702493568ULL,
+    6710882176ULL, 6719274112ULL, 6727662976ULL, 6736052096ULL,
+    6744437632ULL, 6752825984ULL, 6761213824ULL, 6769604224ULL,
+    6777993856ULL, 6786383488ULL, 6794770816ULL, 6803158144ULL,
+    6811549312ULL, 6819937664ULL, 6828326528ULL, 6836706176ULL,
+    6845101696ULL, 6853491328ULL, 6861880448ULL, 6870269312ULL,
+    6878655104ULL, 6887046272ULL, 6895433344ULL, 6903822208ULL,
+    6912212864ULL, 6920596864ULL, 6928988288ULL, 6937377152ULL,
+    6945764992ULL, 6954149248ULL, 6962544256ULL, 6970928768ULL,
+    6979317376ULL, 6987709312ULL, 6996093824ULL, 7004487296ULL,
+    7012875392ULL, 7021258624ULL, 7029652352ULL, 7038038912ULL,
+    7046427776ULL, 7054818944ULL, 7063207808ULL, 7071595136ULL,
+    7079980928ULL, 7088372608ULL, 7096759424ULL, 7105149824ULL,
+    7113536896ULL, 7121928064ULL, 7130315392ULL, 7138699648ULL,
+    7147092352ULL, 7155479168ULL, 7163865728ULL, 7172249984ULL,
+    7180648064ULL, 7189036672ULL, 7197424768ULL, 7205810816ULL,
+    7214196608ULL, 7222589824ULL, 7230975104ULL, 7239367552ULL,
+    7247755904ULL, 7256145536ULL, 7264533376ULL, 7272921472ULL,
+    7281308032ULL, 7289694848ULL, 7298088832ULL, 7306471808ULL,
+    7314864512ULL, 7323253888ULL, 7331643008ULL, 7340029568ULL,
+    7348419712ULL, 7356808832ULL, 7365196672ULL, 7373585792ULL,
+    7381973888ULL, 7390362752ULL, 7398750592ULL, 7407138944ULL,
+    7415528576ULL, 7423915648ULL, 7432302208ULL, 7440690304ULL,
+    7449080192ULL, 7457472128ULL, 7465860992ULL, 7474249088ULL,
+    7482635648ULL, 7491023744ULL, 7499412608ULL, 7507803008ULL,
+    7516192384ULL, 7524579968ULL, 7532967296ULL, 7541358464ULL,
+    7549745792ULL, 7558134656ULL, 7566524032ULL, 7574912896ULL,
+    7583300992ULL, 7591690112ULL, 7600075136ULL, 7608466816ULL,
+    7616854912ULL, 7625244544ULL, 7633629824ULL, 7642020992ULL,
+    7650410368ULL, 7658794112ULL, 7667187328ULL, 7675574912ULL,
+    7683961984ULL, 7692349568ULL, 7700739712ULL, 7709130368ULL,
+    7717519232ULL, 7725905536ULL, 7734295424ULL, 7742683264ULL,
+    7751069056ULL, 7759457408ULL, 7767849088ULL, 7776238208ULL,
+    7784626816ULL, 7793014912ULL, 7801405312ULL, 7809792128ULL,
+    7818179968ULL, 7826571136ULL, 7834957184ULL, 7843347328ULL,
+    7851732352ULL, 7860124544ULL, 7868512384ULL, 7876902016ULL,
+    7885287808ULL, 7893679744ULL, 7902067072ULL, 7910455936ULL,
+    7918844288ULL, 7927230848ULL, 7935622784ULL, 7944009344ULL,
+    7952400256ULL, 7960786048ULL, 7969176704ULL, 7977565312ULL,
+    7985953408ULL, 7994339968ULL, 8002730368ULL, 8011119488ULL,
+    8019508096ULL, 8027896192ULL, 8036285056ULL, 8044674688ULL,
+    8053062272ULL, 8061448832ULL, 8069838464ULL, 8078227328ULL,
+    8086616704ULL, 8095006592ULL, 8103393664ULL, 8111783552ULL,
+    8120171392ULL, 8128560256ULL, 8136949376ULL, 8145336704ULL,
+    8153726848ULL, 8162114944ULL, 8170503296ULL, 8178891904ULL,
+    8187280768ULL, 8195669632ULL, 8204058496ULL, 8212444544ULL,
+    8220834176ULL, 8229222272ULL, 8237612672ULL, 8246000768ULL,
+    8254389376ULL, 8262775168ULL, 8271167104ULL, 8279553664ULL,
+    8287944064ULL, 8296333184ULL, 8304715136ULL, 8313108352ULL,
+    8321497984ULL, 8329885568ULL, 8338274432ULL, 8346663296ULL,
+    8355052928ULL, 8363441536ULL, 8371828352ULL, 8380217984ULL,
+    8388606592ULL, 8396996224ULL, 8405384576ULL, 8413772672ULL,
+    8422161536ULL, 8430549376ULL, 8438939008ULL, 8447326592ULL,
+    8455715456ULL, 8464104832ULL, 8472492928ULL, 8480882048ULL,
+    8489270656ULL, 8497659776ULL, 8506045312ULL, 8514434944ULL,
+    8522823808ULL, 8531208832ULL, 8539602304ULL, 8547990656ULL,
+    8556378752ULL, 8564768384ULL, 8573154176ULL, 8581542784ULL,
+    8589933952ULL, 8598322816ULL, 8606705024ULL, 8615099264ULL,
+    8623487872ULL, 8631876992ULL, 8640264064ULL, 8648653952ULL,
+    8657040256ULL, 8665430656ULL, 8673820544ULL, 8682209152ULL,
+    8690592128ULL, 8698977152ULL, 8707374464ULL, 8715763328ULL,
+    8724151424ULL, 8732540032ULL, 8740928384ULL, 8749315712ULL,
+    8757704576ULL, 8766089344ULL, 8774480768ULL, 8782871936ULL,
+    8791260032ULL, 8799645824ULL, 8808034432ULL, 8816426368ULL,
+    8824812928ULL, 8833199488ULL, 8841591424ULL, 8849976448ULL,
+    8858366336ULL, 8866757248ULL, 8875147136ULL, 8883532928ULL,
+    8891923328ULL, 8900306816ULL, 8908700288ULL, 8917088384ULL,
+    8925478784ULL, 8933867392ULL, 8942250368ULL, 8950644608ULL,
+    8959032704ULL, 8967420544ULL, 8975809664ULL, 8984197504ULL,
+    8992584064ULL, 9000976256ULL, 9009362048ULL, 9017752448ULL,
+    9026141312ULL, 9034530688ULL, 9042917504ULL, 9051307904ULL,
+    9059694208ULL, 9068084864ULL, 9076471424ULL, 9084861824ULL,
+    9093250688ULL, 9101638528ULL, 9110027648ULL, 9118416512ULL,
+    9126803584ULL, 9135188096ULL, 9143581312ULL, 9151969664ULL,
+    9160356224ULL, 9168747136ULL, 9177134464ULL, 9185525632ULL,
+    9193910144ULL, 9202302848ULL, 9210690688ULL, 9219079552ULL,
+    9227465344ULL, 9235854464ULL, 9244244864ULL, 9252633472ULL,
+    9261021824ULL, 9269411456ULL, 9277799296ULL, 9286188928ULL,
+    9294574208ULL, 9302965888ULL, 9311351936ULL, 9319740032ULL,
+    9328131968ULL, 9336516736ULL, 9344907392ULL, 9353296768ULL,
+    9361685888ULL, 9370074752ULL, 9378463616ULL, 9386849408ULL,
+    9395239808ULL, 9403629184ULL, 9412016512ULL, 9420405376ULL,
+    9428795008ULL, 9437181568ULL, 9445570688ULL, 9453960832ULL,
+    9462346624ULL, 9470738048ULL, 9479121536ULL, 9487515008ULL,
+    9495903616ULL, 9504289664ULL, 9512678528ULL, 9521067904ULL,
+    9529456256ULL, 9537843584ULL, 9546233728ULL, 9554621312ULL,
+    9563011456ULL, 9571398784ULL, 9579788672ULL, 9588178304ULL,
+    9596567168ULL, 9604954496ULL, 9613343104ULL, 9621732992ULL,
+    9630121856ULL, 9638508416ULL, 9646898816ULL, 9655283584ULL,
+    9663675776ULL, 9672061312ULL, 9680449664ULL, 9688840064ULL,
+    9697230464ULL, 9705617536ULL, 9714003584ULL, 9722393984ULL,
+    9730772608ULL, 9739172224ULL, 9747561088ULL, 9755945344ULL,
+    9764338816ULL, 9772726144ULL, 9781116544ULL, 9789503872ULL,
+    9797892992ULL, 9806282624ULL, 9814670464ULL, 9823056512ULL,
+    9831439232ULL, 9839833984ULL, 9848224384ULL, 9856613504ULL,
+    9865000576ULL, 9873391232ULL, 9881772416ULL, 9890162816ULL,
+    9898556288ULL, 9906940544ULL, 9915333248ULL, 9923721088ULL,
+    9932108672ULL, 9940496512ULL, 9948888448ULL, 9957276544ULL,
+    9965666176ULL, 9974048384ULL, 9982441088ULL, 9990830464ULL,
+    9999219584ULL, 10007602816ULL, 10015996544ULL, 10024385152ULL,
+    10032774016ULL, 10041163648ULL, 10049548928ULL, 10057940096ULL,
+    10066329472ULL, 10074717824ULL, 10083105152ULL, 10091495296ULL,
+    10099878784ULL, 10108272256ULL, 10116660608ULL, 10125049216ULL,
+    10133437312ULL, 10141825664ULL, 10150213504ULL, 10158601088ULL,
+    10166991232ULL, 10175378816ULL, 10183766144ULL, 10192157312ULL,
+    10200545408ULL, 10208935552ULL, 10217322112ULL, 10225712768ULL,
+    10234099328ULL, 10242489472ULL, 10250876032ULL, 10259264896ULL,
+    10267656064ULL, 10276042624ULL, 10284429184ULL, 10292820352ULL,
+    10301209472ULL, 10309598848ULL, 10317987712ULL, 10326375296ULL,
+    10334763392ULL, 10343153536ULL, 10351541632ULL, 10359930752ULL,
+    10368318592ULL, 10376707456ULL, 10385096576ULL, 10393484672ULL,
+    10401867136ULL, 10410262144ULL, 10418647424ULL, 10427039104ULL,
+    10435425664ULL, 10443810176ULL, 10452203648ULL, 10460589952ULL,
+    10468982144ULL, 10477369472ULL, 10485759104ULL, 10494147712ULL,
+    10502533504ULL, 10510923392ULL, 10519313536ULL, 10527702656ULL,
+    10536091264ULL, 10544478592ULL, 10552867712ULL, 10561255808ULL,
+    10569642368ULL, 10578032768ULL, 10586423168ULL, 10594805632ULL,
+    10603200128ULL, 10611588992ULL, 10619976064ULL, 10628361344ULL,
+    10636754048ULL, 10645143424ULL, 10653531776ULL, 10661920384ULL,
+    10670307968ULL, 10678696832ULL, 10687086464ULL, 10695475072ULL,
+    10703863168ULL, 10712246144ULL, 10720639616ULL, 10729026688ULL,
+    10737414784ULL, 10745806208ULL, 10754190976ULL, 10762581376ULL,
+    10770971264ULL, 10779356288ULL, 10787747456ULL, 10796135552ULL,
+    10804525184ULL, 10812915584ULL, 10821301888ULL, 10829692288ULL,
+    10838078336ULL, 10846469248ULL, 10854858368ULL, 10863247232ULL,
+    10871631488ULL, 10880023424ULL, 10888412032ULL, 10896799616ULL,
+    10905188992ULL, 10913574016ULL, 10921964672ULL, 10930352768ULL,
+    10938742912ULL, 10947132544ULL, 10955518592ULL, 10963909504ULL,
+    10972298368ULL, 10980687488ULL, 10989074816ULL, 10997462912ULL,
+    11005851776ULL, 11014241152ULL, 11022627712ULL, 11031017344ULL,
+    11039403904ULL, 11047793024ULL, 11056184704ULL, 11064570752ULL,
+    11072960896ULL, 11081343872ULL, 11089737856ULL, 11098128256ULL,
+    11106514816ULL, 11114904448ULL, 11123293568ULL, 11131680128ULL,
+    11140065152ULL, 11148458368ULL, 11156845696ULL, 11165236864ULL,
+    11173624192ULL, 11182013824ULL, 11190402688ULL, 11198790784ULL,
+    11207179136ULL, 11215568768ULL, 11223957376ULL, 11232345728ULL,
+    11240734592ULL, 11249122688ULL, 11257511296ULL, 11265899648ULL,
+    11274285952ULL, 11282675584ULL, 11291065472ULL, 11299452544ULL,
+    11307842432ULL, 11316231296ULL, 11324616832ULL, 11333009024ULL,
+    11341395584ULL, 11349782656ULL, 11358172288ULL, 11366560384ULL,
+    11374950016ULL, 11383339648ULL, 11391721856ULL, 11400117376ULL,
+    11408504192ULL, 11416893568ULL, 11425283456ULL, 11433671552ULL,
+    11442061184ULL, 11450444672ULL, 11458837888ULL, 11467226752ULL,
+    11475611776ULL, 11484003968ULL, 11492392064ULL, 11500780672ULL,
+    11509169024ULL, 11517550976ULL, 11525944448ULL, 11534335616ULL,
+    11542724224ULL, 11551111808ULL, 11559500672ULL, 11567890304ULL,
+    11576277376ULL, 11584667008ULL, 11593056128ULL, 11601443456ULL,
+    11609830016ULL, 11618221952ULL, 11626607488ULL, 11634995072ULL,
+    11643387776ULL, 11651775104ULL, 11660161664ULL, 11668552576ULL,
+    11676940928ULL, 11685330304ULL, 11693718656ULL, 11702106496ULL,
+    11710496128ULL, 11718882688ULL, 11727273088ULL, 11735660416ULL,
+    11744050048ULL, 11752437376ULL, 11760824704ULL, 11769216128ULL,
+    11777604736ULL, 11785991296ULL, 11794381952ULL, 11802770048ULL,
+    11811157888ULL, 11819548544ULL, 11827932544ULL, 11836324736ULL,
+    11844713344ULL, 11853100928ULL, 11861486464ULL, 11869879936ULL,
+    11878268032ULL, 11886656896ULL, 11895044992ULL, 11903433088ULL,
+    11911822976ULL, 11920210816ULL, 11928600448ULL, 11936987264ULL,
+    11945375872ULL, 11953761152ULL, 11962151296ULL, 11970543488ULL,
+    11978928512ULL, 11987320448ULL, 11995708288ULL, 12004095104ULL,
+    12012486272ULL, 12020875136ULL, 12029255552ULL, 12037652096ULL,
+    12046039168ULL, 12054429568ULL, 12062813824ULL, 12071206528ULL,
+    12079594624ULL, 12087983744ULL, 12096371072ULL, 12104759936ULL,
+    12113147264ULL, 12121534592ULL, 12129924992ULL, 12138314624ULL,
+    12146703232ULL, 12155091584ULL, 12163481216ULL, 12171864704ULL,
+    12180255872ULL, 12188643968ULL, 12197034112ULL, 12205424512ULL,
+    12213811328ULL, 12222199424ULL, 12230590336ULL, 12238977664ULL,
+    12247365248ULL, 12255755392ULL, 12264143488ULL, 12272531584ULL,
+    12280920448ULL, 12289309568ULL, 12297694592ULL, 12306086528ULL,
+    12314475392ULL, 12322865024ULL, 12331253632ULL, 12339640448ULL,
+    12348029312ULL, 12356418944ULL, 12364805248ULL, 12373196672ULL,
+    12381580928ULL, 12389969024ULL, 12398357632ULL, 12406750592ULL,
+    12415138432ULL, 12423527552ULL, 12431916416ULL, 12440304512ULL,
+    12448692352ULL, 12457081216ULL, 12465467776ULL, 12473859968ULL,
+    12482245504ULL, 12490636672ULL, 12499025536ULL, 12507411584ULL,
+    12515801728ULL, 12524190592ULL, 12532577152ULL, 12540966272ULL,
+    12549354368ULL, 12557743232ULL, 12566129536ULL, 12574523264ULL,
+    12582911872ULL, 12591299456ULL, 12599688064ULL, 12608074624ULL,
+    12616463488ULL, 12624845696ULL, 12633239936ULL, 12641631616ULL,
+    12650019968ULL, 12658407296ULL, 12666795136ULL, 12675183232ULL,
+    12683574656ULL, 12691960192ULL, 12700350592ULL, 12708740224ULL,
+    12717128576ULL, 12725515904ULL, 12733906816ULL, 12742295168ULL,
+    12750680192ULL, 12759071872ULL, 12767460736ULL, 12775848832ULL,
+    12784236928ULL, 12792626816ULL, 12801014656ULL, 12809404288ULL,
+    12817789312ULL, 12826181504ULL, 12834568832ULL, 12842954624ULL,
+    12851345792ULL, 12859732352ULL, 12868122496ULL, 12876512128ULL,
+    12884901248ULL, 12893289088ULL, 12901672832ULL, 12910067584ULL,
+    12918455168ULL, 12926842496ULL, 12935232896ULL, 12943620736ULL,
+    12952009856ULL, 12960396928ULL, 12968786816ULL, 12977176192ULL,
+    12985563776ULL, 12993951104ULL, 13002341504ULL, 13010730368ULL,
+    13019115392ULL, 13027506304ULL, 13035895168ULL, 13044272512ULL,
+    13052673152ULL, 13061062528ULL, 13069446272ULL, 13077838976ULL,
+    13086227072ULL, 13094613632ULL, 13103000192ULL, 13111393664ULL,
+    13119782528ULL, 13128157568ULL, 13136559232ULL, 13144945024ULL,
+    13153329536ULL, 13161724288ULL, 13170111872ULL, 13178502784ULL,
+    13186884736ULL, 13195279744ULL, 13203667072ULL, 13212057472ULL,
+    13220445824ULL, 13228832128ULL, 13237221248ULL, 13245610624ULL,
+    13254000512ULL, 13262388352ULL, 13270777472ULL, 13279166336ULL,
+    13287553408ULL, 13295943296ULL, 13304331904ULL, 13312719488ULL,
+    13321108096ULL, 13329494656ULL, 13337885824ULL, 13346274944ULL,
+    13354663808ULL, 13363051136ULL, 13371439232ULL, 13379825024ULL,
+    13388210816ULL, 13396605056ULL, 13404995456ULL, 13413380224ULL,
+    13421771392ULL, 13430159744ULL, 13438546048ULL, 13446937216ULL,
+    13455326848ULL, 13463708288ULL, 13472103808ULL, 13480492672ULL,
+    13488875648ULL, 13497269888ULL, 13505657728ULL, 13514045312ULL,
+    13522435712ULL, 13530824576ULL, 13539210112ULL, 13547599232ULL,
+    13555989376ULL, 13564379008ULL, 13572766336ULL, 13581154432ULL,
+    13589544832ULL, 13597932928ULL, 13606320512ULL, 13614710656ULL,
+    13623097472ULL, 13631477632ULL, 13639874944ULL, 13648264064ULL,
+    13656652928ULL, 13665041792ULL, 13673430656ULL, 13681818496ULL,
+    13690207616ULL, 13698595712ULL, 13706982272ULL, 13715373184ULL,
+    13723762048ULL, 13732150144ULL, 13740536704ULL, 13748926592ULL,
+    13757316224ULL, 13765700992ULL, 13774090112ULL, 13782477952ULL,
+    13790869376ULL, 13799259008ULL, 13807647872ULL, 13816036736ULL,
+    13824425344ULL, 13832814208ULL, 13841202304ULL, 13849591424ULL,
+    13857978752ULL, 13866368896ULL, 13874754688ULL, 13883145344ULL,
+    13891533184ULL, 13899919232ULL, 13908311168ULL, 13916692096ULL,
+    13925085056ULL, 13933473152ULL, 13941866368ULL, 13950253696ULL,
+    13958643584ULL, 13967032192ULL, 13975417216ULL, 13983807616ULL,
+    13992197504ULL, 14000582272ULL, 14008973696ULL, 14017363072ULL,
+    14025752192ULL, 14034137984ULL, 14042528384ULL, 14050918016ULL,
+    14059301504ULL, 14067691648ULL, 14076083584ULL, 14084470144ULL,
+    14092852352ULL, 14101249664ULL, 14109635968ULL, 14118024832ULL,
+    14126407552ULL, 14134804352ULL, 14143188608ULL, 14151577984ULL,
+    14159968384ULL, 14168357248ULL, 14176741504ULL, 14185127296ULL,
+    14193521024ULL, 14201911424ULL, 14210301824ULL, 14218685056ULL,
+    14227067264ULL, 14235467392ULL, 14243855488ULL, 14252243072ULL,
+    14260630144ULL, 14269021568ULL, 14277409408ULL, 14285799296ULL,
+    14294187904ULL, 14302571392ULL, 14310961792ULL, 14319353728ULL,
+    14327738752ULL, 14336130944ULL, 14344518784ULL, 14352906368ULL,
+    14361296512ULL, 14369685376ULL, 14378071424ULL, 14386462592ULL,
+    14394848128ULL, 14403230848ULL, 14411627392ULL, 14420013952ULL,
+    14428402304ULL, 14436793472ULL, 14445181568ULL, 14453569664ULL,
+    14461959808ULL, 14470347904ULL, 14478737024ULL, 14487122816ULL,
+    14495511424ULL, 14503901824ULL, 14512291712ULL, 14520677504ULL,
+    14529064832ULL, 14537456768ULL, 14545845632ULL, 14554234496ULL,
+    14562618496ULL, 14571011456ULL, 14579398784ULL, 14587789184ULL,
+    14596172672ULL, 14604564608ULL, 14612953984ULL, 14621341312ULL,
+    14629724288ULL, 14638120832ULL, 14646503296ULL, 14654897536ULL,
+    14663284864ULL, 14671675264ULL, 14680061056ULL, 14688447616ULL,
+    14696835968ULL, 14705228416ULL, 14713616768ULL, 14722003328ULL,
+    14730392192ULL, 14738784128ULL, 14747172736ULL, 14755561088ULL,
+    14763947648ULL, 14772336512ULL, 14780725376ULL, 14789110144ULL,
+    14797499776ULL, 14805892736ULL, 14814276992ULL, 14822670208ULL,
+    14831056256ULL, 14839444352ULL, 14847836032ULL, 14856222848ULL,
+    14864612992ULL, 14872997504ULL, 14881388672ULL, 14889775744ULL,
+    14898165376ULL, 14906553472ULL, 14914944896ULL, 14923329664ULL,
+    14931721856ULL, 14940109696ULL, 14948497024ULL, 14956887424ULL,
+    14965276544ULL, 14973663616ULL, 14982053248ULL, 14990439808ULL,
+    14998830976ULL, 15007216768ULL, 15015605888ULL, 15023995264ULL,
+    15032385152ULL, 15040768384ULL, 15049154944ULL, 15057549184ULL,
+    15065939072ULL, 15074328448ULL, 15082715008ULL, 15091104128ULL,
+    15099493504ULL, 15107879296ULL, 15116269184ULL, 15124659584ULL,
+    15133042304ULL, 15141431936ULL, 15149824384ULL, 15158214272ULL,
+    15166602368ULL, 15174991232ULL, 15183378304ULL, 15191760512ULL,
+    15200154496ULL, 15208542592ULL, 15216931712ULL, 15225323392ULL,
+    15233708416ULL, 15242098048ULL, 15250489216ULL, 15258875264ULL,
+    15267265408ULL, 15275654528ULL, 15284043136ULL, 15292431488ULL,
+    15300819584ULL, 15309208192ULL, 15317596544ULL, 15325986176ULL,
+    15334374784ULL, 15342763648ULL, 15351151744ULL, 15359540608ULL,
+    15367929728ULL, 15376318336ULL, 15384706432ULL, 15393092992ULL,
+    15401481856ULL, 15409869952ULL, 15418258816ULL, 15426649984ULL,
+    15435037568ULL, 15443425664ULL, 15451815296ULL, 15460203392ULL,
+    15468589184ULL, 15476979328ULL, 15485369216ULL, 15493755776ULL,
+    15502146944ULL, 15510534272ULL, 15518924416ULL, 15527311232ULL,
+    15535699072ULL, 15544089472ULL, 15552478336ULL, 15560866688ULL,
+    15569254528ULL, 15577642624ULL, 15586031488ULL, 15594419072ULL,
+    15602809472ULL, 15611199104ULL, 15619586432ULL, 15627975296ULL,
+    15636364928ULL, 15644753792ULL, 15653141888ULL, 15661529216ULL,
+    15669918848ULL, 15678305152ULL, 15686696576ULL, 15695083136ULL,
+    15703474048ULL, 15711861632ULL, 15720251264ULL, 15728636288ULL,
+    15737027456ULL, 15745417088ULL, 15753804928ULL, 15762194048ULL,
+    15770582656ULL, 15778971008ULL, 15787358336ULL, 15795747712ULL,
+    15804132224ULL, 15812523392ULL, 15820909696ULL, 15829300096ULL,
+    15837691264ULL, 15846071936ULL, 15854466944ULL, 15862855808ULL,
+    15871244672ULL, 15879634816ULL, 15888020608ULL, 15896409728ULL,
+    15904799104ULL, 15913185152ULL, 15921577088ULL, 15929966464ULL,
+    15938354816ULL, 15946743424ULL, 15955129472ULL, 15963519872ULL,
+    15971907968ULL, 15980296064ULL, 15988684928ULL, 15997073024ULL,
+    16005460864ULL, 16013851264ULL, 16022241152ULL, 16030629248ULL,
+    16039012736ULL, 16047406976ULL, 16055794816ULL, 16064181376ULL,
+    16072571264ULL, 16080957824ULL, 16089346688ULL, 16097737856ULL,
+    16106125184ULL, 16114514816ULL, 16122904192ULL, 16131292544ULL,
+    16139678848ULL, 16148066944ULL, 16156453504ULL, 16164839552ULL,
+    16173236096ULL, 16181623424ULL, 16190012032ULL, 16198401152ULL,
+    16206790528ULL, 16215177344ULL, 16223567744ULL, 16231956352ULL,
+    16240344704ULL, 16248731008ULL, 16257117824ULL, 16265504384ULL,
+    16273898624ULL, 16282281856ULL, 16290668672ULL, 16299064192ULL,
+    16307449216ULL, 16315842176ULL, 16324230016ULL, 16332613504ULL,
+    16341006464ULL, 16349394304ULL, 16357783168ULL, 16366172288ULL,
+    16374561664ULL, 16382951296ULL, 16391337856ULL, 16399726208ULL,
+    16408116352ULL, 16416505472ULL, 16424892032ULL, 16433282176ULL,
+    16441668224ULL, 16450058624ULL, 16458448768ULL, 16466836864ULL,
+    16475224448ULL, 16483613056ULL, 16492001408ULL, 16500391808ULL,
+    16508779648ULL, 16517166976ULL, 16525555328ULL, 16533944192ULL,
+    16542330752ULL, 16550719616ULL, 16559110528ULL, 16567497088ULL,
+    16575888512ULL, 16584274816ULL, 16592665472ULL, 16601051008ULL,
+    16609442944ULL, 16617832064ULL, 16626218624ULL, 16634607488ULL,
+    16642996096ULL, 16651385728ULL, 16659773824ULL, 16668163712ULL,
+    16676552576ULL, 16684938112ULL, 16693328768ULL, 16701718144ULL,
+    16710095488ULL, 16718492288ULL, 16726883968ULL, 16735272832ULL,
+    16743661184ULL, 16752049792ULL, 16760436608ULL, 16768827008ULL,
+    16777214336ULL, 16785599104ULL, 16793992832ULL, 16802381696ULL,
+    16810768768ULL, 16819151744ULL, 16827542656ULL, 16835934848ULL,
+    16844323712ULL, 16852711552ULL, 16861101952ULL, 16869489536ULL,
+    16877876864ULL, 16886265728ULL, 16894653056ULL, 16903044736ULL,
+    16911431296ULL, 16919821696ULL, 16928207488ULL, 16936592768ULL,
+    16944987776ULL, 16953375616ULL, 16961763968ULL, 16970152832ULL,
+    16978540928ULL, 16986929536ULL, 16995319168ULL, 17003704448ULL,
+    17012096896ULL, 17020481152ULL, 17028870784ULL, 17037262208ULL,
+    17045649536ULL, 17054039936ULL, 17062426496ULL, 17070814336ULL,
+    17079205504ULL, 17087592064ULL, 17095978112ULL, 17104369024ULL,
+    17112759424ULL, 17121147776ULL, 17129536384ULL, 17137926016ULL,
+    17146314368ULL, 17154700928ULL, 17163089792ULL, 17171480192ULL,
+    17179864192ULL, 17188256896ULL, 17196644992ULL, 17205033856ULL,
+    17213423488ULL, 17221811072ULL, 17230198912ULL, 17238588032ULL,
+    17246976896ULL, 17255360384ULL, 17263754624ULL, 17272143232ULL,
+    17280530048ULL, 17288918912ULL, 17297309312ULL, 17305696384ULL,
+    17314085504ULL, 17322475136ULL, 17330863744ULL, 17339252096ULL,
+    17347640192ULL, 17356026496ULL, 17364413824ULL, 17372796544ULL,
+    17381190016ULL, 17389583488ULL, 17397972608ULL, 17406360704ULL,
+    17414748544ULL, 17423135872ULL, 17431527296ULL, 17439915904ULL,
+    17448303232ULL, 17456691584ULL, 17465081728ULL, 17473468288ULL,
+    17481857408ULL, 17490247552ULL, 17498635904ULL, 17507022464ULL,
+    17515409024ULL, 17523801728ULL, 17532189824ULL, 17540577664ULL,
+    17548966016ULL, 17557353344ULL, 17565741184ULL, 17574131584ULL,
+    17582519168ULL, 17590907008ULL, 17599296128ULL, 17607687808ULL,
+    17616076672ULL, 17624455808ULL, 17632852352ULL, 17641238656ULL,
+    17649630848ULL, 17658018944ULL, 17666403968ULL, 17674794112ULL,
+    17683178368ULL, 17691573376ULL, 17699962496ULL, 17708350592ULL,
+    17716739968ULL, 17725126528ULL, 17733517184ULL, 17741898112ULL,
+    17750293888ULL, 17758673024ULL, 17767070336ULL, 17775458432ULL,
+    17783848832ULL, 17792236928ULL, 17800625536ULL, 17809012352ULL,
+    17817402752ULL, 17825785984ULL, 17834178944ULL, 17842563968ULL,
+    17850955648ULL, 17859344512ULL, 17867732864ULL, 17876119424ULL,
+    17884511872ULL, 17892900224ULL, 17901287296ULL, 17909677696ULL,
+    17918058112ULL, 17926451072ULL, 17934843776ULL, 17943230848ULL,
+    17951609216ULL, 17960008576ULL, 17968397696ULL, 17976784256ULL,
+    17985175424ULL, 17993564032ULL, 18001952128ULL, 18010339712ULL,
+    18018728576ULL, 18027116672ULL, 18035503232ULL, 18043894144ULL,
+    18052283264ULL, 18060672128ULL, 18069056384ULL, 18077449856ULL,
+    18085837184ULL, 18094225792ULL, 18102613376ULL, 18111004544ULL,
+    18119388544ULL, 18127781248ULL, 18136170368ULL, 18144558976ULL,
+    18152947328ULL, 18161336192ULL, 18169724288ULL, 18178108544ULL,
+    18186498944ULL, 18194886784ULL, 18203275648ULL, 18211666048ULL,
+    18220048768ULL, 18228444544ULL, 18236833408ULL, 18245220736ULL,
+};
+
+#endif